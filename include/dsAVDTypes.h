@@ -482,6 +482,120 @@ typedef struct _dsApplicationAudioConfigList_t {
     dsApplicationAudioConfig_t config[DS_MAX_APPLICATION_AUDIO_CONFIGS];  ///< [out] configuration entries; config[0..returnedCount-1] are valid
 } dsApplicationAudioConfigList_t;
 
+/**
+ * @brief Maximum length of an MS12 audio profile name, including the terminating NUL.
+ * @see dsMS12AudioProfileList_t
+ */
+#define DS_MAX_MS12_AUDIO_PROFILE_NAME_LEN 32
+
+/**
+ * @brief This enumeration defines the properties that can be requested in a ::dsAudioPortState_t.
+ * Each bit of uint32_t represents one property; requests are the bitwise OR of the properties needed.
+ * New properties are only ever appended, existing values never change.
+ * @note Used in @link dsAudio.h @endlink
+ */
+typedef enum _dsAudioPortStateField_t {
+    dsAUDIOPORT_STATE_PORT_ENABLED              = 0x00000001,   ///< dsAudioPortState_t::enabled, as dsIsAudioPortEnabled()
+    dsAUDIOPORT_STATE_CONNECTED                 = 0x00000002,   ///< dsAudioPortState_t::connected, as dsAudioOutIsConnected()
+    dsAUDIOPORT_STATE_MUTE                      = 0x00000004,   ///< dsAudioPortState_t::muted, as dsIsAudioMute()
+    dsAUDIOPORT_STATE_FORMAT                    = 0x00000008,   ///< dsAudioPortState_t::format, as dsGetAudioFormat()
+    dsAUDIOPORT_STATE_COMPRESSION               = 0x00000010,   ///< dsAudioPortState_t::compression, as dsGetAudioCompression()
+    dsAUDIOPORT_STATE_STEREO_MODE               = 0x00000020,   ///< dsAudioPortState_t::stereoMode, as dsGetStereoMode()
+    dsAUDIOPORT_STATE_STEREO_AUTO               = 0x00000040,   ///< dsAudioPortState_t::stereoAuto, as dsGetStereoAuto()
+    dsAUDIOPORT_STATE_GAIN                      = 0x00000080,   ///< dsAudioPortState_t::gain, as dsGetAudioGain()
+    dsAUDIOPORT_STATE_LEVEL                     = 0x00000100,   ///< dsAudioPortState_t::level, as dsGetAudioLevel()
+    dsAUDIOPORT_STATE_DELAY                     = 0x00000200,   ///< dsAudioPortState_t::delayMs, as dsGetAudioDelay()
+    dsAUDIOPORT_STATE_MS12_PROFILE              = 0x00000400,   ///< dsAudioPortState_t::ms12Profile, as dsGetMS12AudioProfile()
+    dsAUDIOPORT_STATE_DIALOG_ENHANCEMENT        = 0x00000800,   ///< dsAudioPortState_t::dialogEnhancement, as dsGetDialogEnhancement()
+    dsAUDIOPORT_STATE_DOLBY_VOLUME_MODE         = 0x00001000,   ///< dsAudioPortState_t::dolbyVolumeMode, as dsGetDolbyVolumeMode()
+    dsAUDIOPORT_STATE_INTELLIGENT_EQUALIZER     = 0x00002000,   ///< dsAudioPortState_t::intelligentEqualizerMode, as dsGetIntelligentEqualizerMode()
+    dsAUDIOPORT_STATE_VOLUME_LEVELLER           = 0x00004000,   ///< dsAudioPortState_t::volumeLeveller, as dsGetVolumeLeveller()
+    dsAUDIOPORT_STATE_BASS_ENHANCER             = 0x00008000,   ///< dsAudioPortState_t::bassBoost, as dsGetBassEnhancer()
+    dsAUDIOPORT_STATE_SURROUND_DECODER          = 0x00010000,   ///< dsAudioPortState_t::surroundDecoderEnabled, as dsIsSurroundDecoderEnabled()
+    dsAUDIOPORT_STATE_DRC_MODE                  = 0x00020000,   ///< dsAudioPortState_t::drcMode, as dsGetDRCMode()
+    dsAUDIOPORT_STATE_SURROUND_VIRTUALIZER      = 0x00040000,   ///< dsAudioPortState_t::surroundVirtualizer, as dsGetSurroundVirtualizer()
+    dsAUDIOPORT_STATE_MI_STEERING               = 0x00080000,   ///< dsAudioPortState_t::miSteering, as dsGetMISteering()
+    dsAUDIOPORT_STATE_GRAPHIC_EQUALIZER         = 0x00100000,   ///< dsAudioPortState_t::graphicEqualizerMode, as dsGetGraphicEqualizerMode()
+    dsAUDIOPORT_STATE_LE_CONFIG                 = 0x00200000,   ///< dsAudioPortState_t::loudnessEquivalence, as dsGetLEConfig()
+    dsAUDIOPORT_STATE_ASSOCIATED_AUDIO_MIXING   = 0x00400000,   ///< dsAudioPortState_t::associatedAudioMixing, as dsGetAssociatedAudioMixing()
+    dsAUDIOPORT_STATE_FADER_CONTROL             = 0x00800000,   ///< dsAudioPortState_t::faderControl, as dsGetFaderControl()
+    dsAUDIOPORT_STATE_PRIMARY_LANGUAGE          = 0x01000000,   ///< dsAudioPortState_t::primaryLanguage, as dsGetPrimaryLanguage()
+    dsAUDIOPORT_STATE_SECONDARY_LANGUAGE        = 0x02000000,   ///< dsAudioPortState_t::secondaryLanguage, as dsGetSecondaryLanguage()
+    dsAUDIOPORT_STATE_ALL                       = 0x03FFFFFF,   ///< All of the above
+} dsAudioPortStateField_t;
+
+/**
+ * @brief Consistent snapshot of the state of one audio port, including MS12 post-processing state.
+ * The caller sets @c size to its compiled sizeof(dsAudioPortState_t) and @c requestedMask
+ * to the bitwise OR of the ::dsAudioPortStateField_t properties it needs.
+ * Fields are only ever appended; the implementation must not write beyond @c size bytes,
+ * so callers built against older versions of this structure remain compatible.
+ * On return, @c validMask holds the properties that were filled. A requested property that is not
+ * supported by the platform or by the port (e.g. MS12 post-processing on source devices) is left
+ * unset in @c validMask rather than failing the whole call.
+ * Value ranges for each field are as documented on the corresponding getter.
+ * @note Used in @link dsAudio.h @endlink
+ */
+typedef struct _dsAudioPortState_t {
+    uint32_t size;                                          ///< [in]  sizeof(dsAudioPortState_t) as compiled by the caller
+    uint32_t requestedMask;                                 ///< [in]  Bitwise OR of requested properties.  Please refer ::dsAudioPortStateField_t
+    uint32_t validMask;                                     ///< [out] Bitwise OR of properties filled in by the implementation
+    bool enabled;                                           ///< [out] Audio port enabled ( @a true if enabled, @a false otherwise)
+    bool connected;                                         ///< [out] Audio output connected ( @a true if connected, @a false otherwise)
+    bool muted;                                             ///< [out] Audio port muted ( @a true if muted, @a false otherwise)
+    dsAudioFormat_t format;                                 ///< [out] Current audio format.  Please refer ::dsAudioFormat_t
+    int compression;                                        ///< [out] Audio compression level
+    dsAudioStereoMode_t stereoMode;                         ///< [out] Stereo mode.  Please refer ::dsAudioStereoMode_t
+    int stereoAuto;                                         ///< [out] Stereo auto mode
+    float gain;                                             ///< [out] Audio gain
+    float level;                                            ///< [out] Audio level
+    uint32_t delayMs;                                       ///< [out] Audio delay in milliseconds
+    char ms12Profile[DS_MAX_MS12_AUDIO_PROFILE_NAME_LEN];   ///< [out] NUL-terminated current MS12 audio profile name
+    int dialogEnhancement;                                  ///< [out] Dialog enhancement level
+    bool dolbyVolumeMode;                                   ///< [out] Dolby volume mode ( @a true if enabled, @a false otherwise)
+    int intelligentEqualizerMode;                           ///< [out] Intelligent equalizer mode
+    dsVolumeLeveller_t volumeLeveller;                      ///< [out] Volume leveller.  Please refer ::dsVolumeLeveller_t
+    int bassBoost;                                          ///< [out] Bass enhancer boost value
+    bool surroundDecoderEnabled;                            ///< [out] Surround decoder ( @a true if enabled, @a false otherwise)
+    int drcMode;                                            ///< [out] DRC mode
+    dsSurroundVirtualizer_t surroundVirtualizer;            ///< [out] Surround virtualizer.  Please refer ::dsSurroundVirtualizer_t
+    bool miSteering;                                        ///< [out] Media intelligent steering ( @a true if enabled, @a false otherwise)
+    int graphicEqualizerMode;                               ///< [out] Graphic equalizer mode
+    bool loudnessEquivalence;                               ///< [out] Loudness equivalence ( @a true if enabled, @a false otherwise)
+    bool associatedAudioMixing;                             ///< [out] Associated audio mixing ( @a true if enabled, @a false otherwise)
+    int faderControl;                                       ///< [out] Fader control mixer balance
+    char primaryLanguage[MAX_LANGUAGE_LEN];                 ///< [out] NUL-terminated AC4 primary language code
+    char secondaryLanguage[MAX_LANGUAGE_LEN];               ///< [out] NUL-terminated AC4 secondary language code
+} dsAudioPortState_t;
+
+/**
+ * @brief Set of MS12 audio profile and post-processing settings applied atomically by dsApplyAudioConfig().
+ * The caller sets @c size to its compiled sizeof(dsAudioConfigBatch_t) and @c applyMask to the bitwise OR
+ * of the ::dsAudioPortStateField_t properties to change; fields whose bit is not set are ignored.
+ * Only the properties that have a field in this structure may be set in @c applyMask.
+ * Fields are only ever appended; the implementation must not read beyond @c size bytes.
+ * A property selected in @c applyMask whose field lies wholly or partly beyond @c size is rejected with
+ * dsERR_INVALID_PARAM and nothing is applied; it is never silently skipped.
+ * Value ranges for each field are as documented on the corresponding setter.
+ * @note Used in @link dsAudio.h @endlink
+ */
+typedef struct _dsAudioConfigBatch_t {
+    uint32_t size;                                          ///< [in] sizeof(dsAudioConfigBatch_t) as compiled by the caller
+    uint32_t applyMask;                                     ///< [in] Bitwise OR of properties to apply.  Please refer ::dsAudioPortStateField_t
+    char ms12Profile[DS_MAX_MS12_AUDIO_PROFILE_NAME_LEN];   ///< [in] NUL-terminated MS12 audio profile name, as dsSetMS12AudioProfile()
+    int dialogEnhancement;                                  ///< [in] Dialog enhancement level, as dsSetDialogEnhancement()
+    bool dolbyVolumeMode;                                   ///< [in] Dolby volume mode, as dsSetDolbyVolumeMode()
+    int intelligentEqualizerMode;                           ///< [in] Intelligent equalizer mode, as dsSetIntelligentEqualizerMode()
+    dsVolumeLeveller_t volumeLeveller;                      ///< [in] Volume leveller, as dsSetVolumeLeveller()
+    int bassBoost;                                          ///< [in] Bass enhancer boost value, as dsSetBassEnhancer()
+    bool surroundDecoderEnabled;                            ///< [in] Surround decoder, as dsEnableSurroundDecoder()
+    int drcMode;                                            ///< [in] DRC mode, as dsSetDRCMode()
+    dsSurroundVirtualizer_t surroundVirtualizer;            ///< [in] Surround virtualizer, as dsSetSurroundVirtualizer()
+    bool miSteering;                                        ///< [in] Media intelligent steering, as dsSetMISteering()
+    int graphicEqualizerMode;                               ///< [in] Graphic equalizer mode, as dsSetGraphicEqualizerMode()
+    bool loudnessEquivalence;                               ///< [in] Loudness equivalence, as dsEnableLEConfig()
+} dsAudioConfigBatch_t;
+
 /* End of DSHAL_AUDIO_TYPES doxygen group */
 /**
  * @}
@@ -792,6 +906,35 @@ typedef struct _dsDisplayEDID_t {
     char monitorName[dsEEDID_MAX_MON_NAME_LENGTH];  ///<  Connected Display Monitor Name
 } dsDisplayEDID_t;
 
+/**
+ * @brief Compact 8-byte descriptor of a resolution supported by the connected display.
+ * Carries the same information as ::dsVideoPortResolution_t without the name string;
+ * each enumeration value is stored in one byte. Layout is frozen.
+ * @note Used in @link dsDisplay.h @endlink
+ */
+typedef struct _dsVideoPortResolutionDescriptor_t {
+    uint8_t pixelResolution;    ///< Resolution.  Please refer ::dsVideoResolution_t
+    uint8_t aspectRatio;        ///< Aspect ratio.  Please refer ::dsVideoAspectRatio_t
+    uint8_t stereoScopicMode;   ///< Stereoscopic mode.  Please refer ::dsVideoStereoScopicMode_t
+    uint8_t frameRate;          ///< Frame rate.  Please refer ::dsVideoFrameRate_t
+    uint8_t interlaced;         ///< Scan mode ( 1 if interlaced, 0 if progressive )
+    uint8_t vic;                ///< CTA-861 Video Identification Code, 0 if the mode has no VIC
+    uint8_t reserved[2];        ///< Reserved, set to 0
+} dsVideoPortResolutionDescriptor_t;
+
+/**
+ * @brief Read-only view of an EDID block cached by the HAL.
+ * The block pointed to by @c data is owned by the HAL and stays valid and unchanged until the view
+ * is released, even if the cached EDID is replaced in the meantime. The caller must not modify
+ * or free it.
+ * @note Used in @link dsDisplay.h @endlink, @link dsHdmiIn.h @endlink and @link dsHost.h @endlink
+ */
+typedef struct _dsEDIDView_t {
+    const uint8_t *data;    ///< Raw EDID bytes
+    uint32_t length;        ///< Number of valid bytes in @c data. Max value is as documented for the corresponding copying API
+    uint32_t generation;    ///< Generation of the EDID this view refers to
+} dsEDIDView_t;
+
 /**
  * @brief This enumeration defines the types of powerstate
  */
@@ -880,6 +1023,72 @@ typedef enum _dsAudioInput_t
  * @}
  */
 
+/** @addtogroup DSHAL_VIDEOPORT_TYPES Device Settings HAL VideoPort Type Definitions
+ *  @ingroup DSHAL_VIDEOPORT
+ *  @{
+ */
+
+/**
+ * @brief Structure that holds the current output settings of a video port.
+ * Field meanings match the corresponding dsGetCurrentOutputSettings() parameters.
+ * @note Used in @link dsVideoPort.h @endlink
+ */
+typedef struct _dsVideoPortOutputSettings_t {
+    dsHDRStandard_t videoEOTF;                              ///< EOTF value.  Please refer ::dsHDRStandard_t
+    dsDisplayMatrixCoefficients_t matrixCoefficients;       ///< Matrix coefficients.  Please refer ::dsDisplayMatrixCoefficients_t
+    dsDisplayColorSpace_t colorSpace;                       ///< Color space.  Please refer ::dsDisplayColorSpace_t
+    unsigned int colorDepth;                                ///< Color depth.  Please refer ::dsDisplayColorDepth_t
+    dsDisplayQuantizationRange_t quantizationRange;         ///< Quantization range.  Please refer ::dsDisplayQuantizationRange_t
+} dsVideoPortOutputSettings_t;
+
+/**
+ * @brief This enumeration defines the properties that can be requested in a ::dsVideoPortStateSnapshot_t.
+ * Each bit of uint32_t represents one property group; requests are the bitwise OR of the groups needed.
+ * New groups are only ever appended, existing values never change.
+ * @note Used in @link dsVideoPort.h @endlink
+ */
+typedef enum _dsVideoPortStateField_t {
+    dsVIDEOPORT_STATE_PORT_ENABLED          = 0x0001,   ///< dsVideoPortStateSnapshot_t::enabled, as dsIsVideoPortEnabled()
+    dsVIDEOPORT_STATE_DISPLAY_CONNECTED     = 0x0002,   ///< dsVideoPortStateSnapshot_t::displayConnected, as dsIsDisplayConnected()
+    dsVIDEOPORT_STATE_PORT_ACTIVE           = 0x0004,   ///< dsVideoPortStateSnapshot_t::active, as dsIsVideoPortActive()
+    dsVIDEOPORT_STATE_RESOLUTION            = 0x0008,   ///< dsVideoPortStateSnapshot_t::resolution, as dsGetResolution()
+    dsVIDEOPORT_STATE_HDCP_STATUS           = 0x0010,   ///< dsVideoPortStateSnapshot_t::hdcpStatus, as dsGetHDCPStatus()
+    dsVIDEOPORT_STATE_OUTPUT_HDR            = 0x0020,   ///< dsVideoPortStateSnapshot_t::outputHDR, as dsIsOutputHDR()
+    dsVIDEOPORT_STATE_PREFERRED_COLOR_DEPTH = 0x0040,   ///< dsVideoPortStateSnapshot_t::preferredColorDepth, as dsGetPreferredColorDepth()
+    dsVIDEOPORT_STATE_OUTPUT_SETTINGS       = 0x0080,   ///< dsVideoPortStateSnapshot_t::outputSettings, as dsGetCurrentOutputSettings()
+    dsVIDEOPORT_STATE_ALL                   = 0x00FF,   ///< All of the above
+} dsVideoPortStateField_t;
+
+/**
+ * @brief Consistent snapshot of the state of one video port.
+ * The caller sets @c size to its compiled sizeof(dsVideoPortStateSnapshot_t) and @c requestedMask
+ * to the bitwise OR of the ::dsVideoPortStateField_t groups it needs.
+ * Fields are only ever appended; the implementation must not write beyond @c size bytes,
+ * so callers built against older versions of this structure remain compatible.
+ * On return, @c validMask holds the groups that were filled. A requested group that the
+ * platform does not support (e.g. dsVIDEOPORT_STATE_PREFERRED_COLOR_DEPTH on sink devices)
+ * is left unset in @c validMask rather than failing the whole call.
+ * @note Used in @link dsVideoPort.h @endlink
+ */
+typedef struct _dsVideoPortStateSnapshot_t {
+    uint32_t size;                                  ///< [in]  sizeof(dsVideoPortStateSnapshot_t) as compiled by the caller
+    uint32_t requestedMask;                         ///< [in]  Bitwise OR of requested groups.  Please refer ::dsVideoPortStateField_t
+    uint32_t validMask;                             ///< [out] Bitwise OR of groups filled in by the implementation
+    bool enabled;                                   ///< [out] Video port enabled ( @a true if enabled, @a false otherwise)
+    bool displayConnected;                          ///< [out] Display connected ( @a true if connected, @a false otherwise)
+    bool active;                                    ///< [out] Video port active ( @a true if active, @a false otherwise)
+    bool outputHDR;                                 ///< [out] Video output is HDR ( @a true if HDR, @a false otherwise)
+    dsVideoPortResolution_t resolution;             ///< [out] Current resolution.  Please refer ::dsVideoPortResolution_t
+    dsHdcpStatus_t hdcpStatus;                      ///< [out] HDCP status.  Please refer ::dsHdcpStatus_t
+    dsDisplayColorDepth_t preferredColorDepth;      ///< [out] Preferred color depth.  Please refer ::dsDisplayColorDepth_t
+    dsVideoPortOutputSettings_t outputSettings;     ///< [out] Current output settings.  Please refer ::dsVideoPortOutputSettings_t
+} dsVideoPortStateSnapshot_t;
+
+/* End of DSHAL_VIDEOPORT_TYPES doxygen group */
+/**
+ * @}
+ */
+
 #endif /* __DS_AVD_TYPES_H__ */
 
 /** @} */ // End of DSHAL_AVD_TYPES
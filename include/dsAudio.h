@@ -1837,6 +1837,67 @@ dsError_t  dsGetApplicationAudioConfig(intptr_t handle, const dsApplicationAudio
  */
 dsError_t  dsGetApplicationAudioConfigList(intptr_t handle, dsApplicationAudioConfigList_t* audioConfigList);
 
+/**
+ * @brief Gets a consistent snapshot of the requested state of an audio port in one call.
+ *
+ * This function fills every property requested in portState->requestedMask, equivalent to calling the
+ * individual getters listed in ::dsAudioPortStateField_t (e.g. dsGetDialogEnhancement(), dsGetDolbyVolumeMode(),
+ * dsGetVolumeLeveller(), dsGetDRCMode(), dsGetSurroundVirtualizer(), dsGetMS12AudioProfile()).
+ * All returned values must reflect the same instant; a concurrent profile change or setter must not
+ * be visible part way through the snapshot.
+ * See ::dsAudioPortState_t for the size and mask contract.
+ *
+ * @param[in]     handle     - Handle for the output audio port
+ * @param[in,out] portState  - Audio port state to be filled.  Please refer ::dsAudioPortState_t
+ *
+ * @return dsError_t                      -  Status
+ * @retval dsERR_NONE                     -  Success; portState->validMask holds the filled properties
+ * @retval dsERR_NOT_INITIALIZED          -  Module is not initialised
+ * @retval dsERR_INVALID_PARAM            -  handle is invalid, portState is NULL, or size is smaller than
+ *                                           offsetof(dsAudioPortState_t, validMask) + sizeof(uint32_t)
+ * @retval dsERR_OPERATION_NOT_SUPPORTED  -  None of the requested properties are supported
+ * @retval dsERR_GENERAL                  -  Underlying undefined platform error
+ *
+ * @pre  dsAudioPortInit() and dsGetAudioPort() should be called before calling this API.
+ *
+ * @warning  This API is Not thread safe.
+ */
+dsError_t  dsGetAudioPortState(intptr_t handle, dsAudioPortState_t* portState);
+
+/**
+ * @brief Applies an MS12 audio profile and post-processing settings to an audio port as one transaction.
+ *
+ * For sink devices, this function validates every property selected in config->applyMask before changing
+ * anything, then commits all of them to the audio pipeline with a single reconfiguration.
+ * When dsAUDIOPORT_STATE_MS12_PROFILE is selected, the profile is applied first and the other selected
+ * properties override the profile defaults, giving the same end state as calling dsSetMS12AudioProfile()
+ * followed by the individual setters, but without intermediate pipeline reconfigurations.
+ * Either all selected properties are applied, or none are and the previous configuration remains in effect.
+ * For source devices, this function returns dsERR_OPERATION_NOT_SUPPORTED always.
+ *
+ * @param[in] handle  - Handle for the output audio port
+ * @param[in] config  - Settings to apply.  Please refer ::dsAudioConfigBatch_t
+ *
+ * @return dsError_t                      -  Status
+ * @retval dsERR_NONE                     -  Success; all selected properties are applied
+ * @retval dsERR_NOT_INITIALIZED          -  Module is not initialised
+ * @retval dsERR_INVALID_PARAM            -  handle is invalid, config is NULL, size is smaller than
+ *                                           offsetof(dsAudioConfigBatch_t, ms12Profile), applyMask selects a property
+ *                                           without a field in ::dsAudioConfigBatch_t, applyMask selects a property whose
+ *                                           field lies beyond size, or any selected value is out of range.
+ *                                           Nothing is applied.
+ * @retval dsERR_OPERATION_NOT_SUPPORTED  -  Any selected property is not supported by the port. Nothing is applied.
+ * @retval dsERR_OPERATION_FAILED         -  The commit to the audio pipeline failed. The previous configuration remains in effect.
+ * @retval dsERR_GENERAL                  -  Underlying undefined platform error
+ *
+ * @pre  dsAudioPortInit() and dsGetAudioPort() should be called before calling this API.
+ *
+ * @warning  This API is Not thread safe.
+ *
+ * @see dsGetAudioPortState(), dsSetMS12AudioProfile()
+ */
+dsError_t  dsApplyAudioConfig(intptr_t handle, const dsAudioConfigBatch_t* config);
+
 #ifdef __cplusplus
 }
 #endif
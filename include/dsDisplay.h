@@ -177,6 +177,10 @@ dsError_t dsDisplayInit();
  * 
  * This function gets the EDID information from the HDMI/DVI display corresponding to
  * the specified display device handle.
+ * The HAL must parse the EDID once per connection and serve this call from its cache.
+ * The cache is invalidated on dsDISPLAY_EVENT_CONNECTED, dsDISPLAY_EVENT_DISCONNECTED and dsDisplayInit().
+ * While no valid EDID is cached (e.g. the DDC read at hot plug failed or was incomplete), the HAL may re-read
+ * the EDID on this call; please refer dsGetEDIDBytes().
  * 
  * @param[in]  handle   - Handle of the display device
  * @param[out] edid     - EDID info of the specified display device. Please refer ::dsDisplayEDID_t
@@ -207,6 +211,12 @@ dsError_t dsGetEDID(intptr_t handle, dsDisplayEDID_t *edid);
  * @param[out] length   - length of the EDID buffer data. Min value is 0
  *
  * @note Caller is responsible for allocating memory for edid( please refer ::MAX_EDID_BYTES_LEN ) and freeing the EDID buffer
+ * @note The HAL must read the EDID from the display once per connection and serve this call from its cache,
+ *       without a new DDC transaction. The cache is invalidated on dsDISPLAY_EVENT_CONNECTED,
+ *       dsDISPLAY_EVENT_DISCONNECTED and dsDisplayInit(). While no valid EDID is cached, because the read at
+ *       hot plug failed or returned a partial or corrupt EDID, the HAL may retry the DDC read, either in the
+ *       background or on this call; a retry that succeeds fills the cache and increments the generation.
+ *       Please refer dsGetEDIDGeneration()
  *
  * @return dsError_t                        - Status
  * @retval dsERR_NONE                       - Success
@@ -223,6 +233,144 @@ dsError_t dsGetEDID(intptr_t handle, dsDisplayEDID_t *edid);
 
 dsError_t dsGetEDIDBytes(intptr_t handle, unsigned char *edid, int *length);
 
+/**
+ * @brief Gets the EDID generation counter of the connected display device.
+ *
+ * The generation identifies the EDID currently cached by the HAL for the specified display device.
+ * It is incremented each time the cache is invalidated by dsDISPLAY_EVENT_CONNECTED or
+ * dsDISPLAY_EVENT_DISCONNECTED, before the corresponding dsDisplayEventCallback_t() is delivered,
+ * when a retried read fills a cache that held no valid EDID, and by dsDisplayInit(); it is unchanged otherwise.
+ * A caller that stores the generation together with the EDID it read can skip calling dsGetEDID() and
+ * dsGetEDIDBytes() again while the generation is unchanged.
+ * The generation never goes backwards: it is not reset by dsDisplayTerm() and dsDisplayInit() within the life
+ * of the process, and a re-initialisation counts as an invalidation, since the display may have been replaced
+ * while the module was terminated. Wrap-around is permitted.
+ * This function must not access the display.
+ *
+ * @param[in]  handle       - Handle of the display device
+ * @param[out] generation   - Pointer to hold the EDID generation counter
+ *
+ * @return dsError_t                        - Status
+ * @retval dsERR_NONE                       - Success
+ * @retval dsERR_NOT_INITIALIZED            - Module is not initialised
+ * @retval dsERR_INVALID_PARAM              - Parameter passed to this function is invalid
+ * @retval dsERR_OPERATION_NOT_SUPPORTED    - The attempted operation is not supported
+ * @retval dsERR_GENERAL                    - Underlying undefined platform error
+ *
+ * @pre  dsDisplayInit() and dsGetDisplay() must be called before calling this API
+ *
+ * @warning  This API is Not thread safe
+ *
+ * @see dsGetEDID(), dsGetEDIDBytes()
+ */
+dsError_t dsGetEDIDGeneration(intptr_t handle, uint32_t *generation);
+
+/**
+ * @brief Gets the number of resolutions supported by the connected display device.
+ *
+ * This function returns the number of entries available through dsGetEDIDResolutions(),
+ * which is the same as dsDisplayEDID_t::numOfSupportedResolution. It is served from the cached EDID.
+ *
+ * @param[in]  handle   - Handle of the display device
+ * @param[out] count    - Pointer to hold the number of supported resolutions. Max value is ::dsEEDID_MAX_VIDEO_CODE
+ *
+ * @return dsError_t                        - Status
+ * @retval dsERR_NONE                       - Success
+ * @retval dsERR_NOT_INITIALIZED            - Module is not initialised
+ * @retval dsERR_INVALID_PARAM              - Parameter passed to this function is invalid
+ * @retval dsERR_OPERATION_NOT_SUPPORTED    - The attempted operation is not supported
+ * @retval dsERR_GENERAL                    - Underlying undefined platform error
+ *
+ * @pre  dsDisplayInit() and dsGetDisplay() must be called before calling this API
+ *
+ * @warning  This API is Not thread safe
+ *
+ * @see dsGetEDIDResolutions()
+ */
+dsError_t dsGetEDIDResolutionCount(intptr_t handle, uint32_t *count);
+
+/**
+ * @brief Gets a range of resolutions supported by the connected display device.
+ *
+ * This function copies up to @a count compact descriptors, starting at index @a offset, of the resolution list
+ * that dsGetEDID() returns in dsDisplayEDID_t::suppResolutionList, in the same order.
+ * It allows callers to read only the entries they need instead of the full ::dsDisplayEDID_t.
+ * A caller reading the list in several calls should compare dsGetEDIDGeneration() before and after
+ * to detect that the display changed in between.
+ *
+ * @param[in]  handle       - Handle of the display device
+ * @param[in]  offset       - Index of the first resolution to copy. Min value is 0
+ * @param[in]  count        - Number of entries available in @a resolutions. Min value is 1
+ * @param[out] resolutions  - Caller allocated array of at least @a count entries.  Please refer ::dsVideoPortResolutionDescriptor_t
+ * @param[out] returned     - Pointer to hold the number of entries written. It is 0 when @a offset is
+ *                              at or past the end of the list
+ *
+ * @return dsError_t                        - Status
+ * @retval dsERR_NONE                       - Success
+ * @retval dsERR_NOT_INITIALIZED            - Module is not initialised
+ * @retval dsERR_INVALID_PARAM              - Parameter passed to this function is invalid
+ * @retval dsERR_OPERATION_NOT_SUPPORTED    - The attempted operation is not supported
+ * @retval dsERR_GENERAL                    - Underlying undefined platform error
+ *
+ * @pre  dsDisplayInit() and dsGetDisplay() must be called before calling this API
+ *
+ * @warning  This API is Not thread safe
+ *
+ * @see dsGetEDIDResolutionCount(), dsGetEDIDGeneration()
+ */
+dsError_t dsGetEDIDResolutions(intptr_t handle, uint32_t offset, uint32_t count, dsVideoPortResolutionDescriptor_t *resolutions, uint32_t *returned);
+
+/**
+ * @brief Acquires a read-only view of the EDID of the connected display device.
+ *
+ * This function returns a pointer to the EDID block held by the HAL instead of copying it.
+ * Each successful call takes a reference on the block that must be dropped with dsReleaseEDIDView().
+ * The block is kept alive while referenced, so a view stays valid across EDID changes; the
+ * generation in the view tells the caller whether it still matches the current EDID.
+ * The generation is the value returned by dsGetEDIDGeneration() for the same EDID.
+ *
+ * @param[in]  handle      - Handle of the display device
+ * @param[out] view         - View to be filled.  Please refer ::dsEDIDView_t
+ *
+ * @return dsError_t                        - Status
+ * @retval dsERR_NONE                       - Success
+ * @retval dsERR_NOT_INITIALIZED            - Module is not initialised
+ * @retval dsERR_INVALID_PARAM              - Parameter passed to this function is invalid
+ * @retval dsERR_OPERATION_NOT_SUPPORTED    - The attempted operation is not supported
+ * @retval dsERR_GENERAL                    - Underlying undefined platform error
+ *
+ * @pre dsDisplayInit() and dsGetDisplay() must be called before calling this API.
+ * @post dsReleaseEDIDView() must be called to release the view.
+ *
+ * @warning  This API is Not thread safe.
+ *
+ * @see dsReleaseEDIDView(), dsGetEDIDBytes()
+ */
+dsError_t dsAcquireEDIDView(intptr_t handle, dsEDIDView_t *view);
+
+/**
+ * @brief Releases a view acquired with dsAcquireEDIDView().
+ *
+ * On return, view->data is set to NULL and must not be dereferenced.
+ * All views must be released before the module is terminated.
+ *
+ * @param[in]  handle      - Handle of the display device
+ * @param[in,out] view     - View returned by dsAcquireEDIDView().  Please refer ::dsEDIDView_t
+ *
+ * @return dsError_t                        - Status
+ * @retval dsERR_NONE                       - Success
+ * @retval dsERR_NOT_INITIALIZED            - Module is not initialised
+ * @retval dsERR_INVALID_PARAM              - Parameter passed to this function is invalid, or view was not acquired
+ * @retval dsERR_GENERAL                    - Underlying undefined platform error
+ *
+ * @pre dsAcquireEDIDView() must be called before calling this API.
+ *
+ * @warning  This API is Not thread safe.
+ *
+ * @see dsAcquireEDIDView()
+ */
+dsError_t dsReleaseEDIDView(intptr_t handle, dsEDIDView_t *view);
+
 /**
  * @brief Get the source device’s aspect ratio based on the resolution.
  *
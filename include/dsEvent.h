@@ -0,0 +1,536 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2026 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+/**
+ * @addtogroup HPK Hardware Porting Kit
+ * @{
+ * @par The Hardware Porting Kit
+ * HPK is the next evolution of the well-defined Hardware Abstraction Layer
+ * (HAL), but augmented with more comprehensive documentation and test suites
+ * that OEM or SOC vendors can use to self-certify their ports before taking
+ * them to RDKM for validation or to an operator for final integration and
+ * deployment. The Hardware Porting Kit effectively enables an OEM and/or SOC
+ * vendor to self-certify their own Video Accelerator devices, with minimal RDKM
+ * assistance.
+ *
+ */
+
+/**
+ * @addtogroup Device_Settings Device Settings Module
+ * @{
+ */
+
+/**
+ * @addtogroup Device_Settings_HAL Device Settings HAL
+ * @par Application API Specification
+ * Described herein are the DeviceSettings HAL types and functions that are part of
+ * the Event subsystem. The Event subsystem delivers the notifications of all other DS HAL subsystems.
+ *  @{
+ */
+
+/**
+*   @defgroup dsEvent_HAL DS Event HAL
+ *  @{
+ * @par Application API Specification
+ * dsEvent HAL provides an interface for subscribing to the notifications of the device settings module
+ */
+
+/**
+ * @defgroup DSHAL_EVENT_API DS HAL Event Public APIs
+ *  @{
+ */
+
+/**
+ * @file dsEvent.h
+ *
+ * @brief Device Settings HAL Event Public API.
+ * This API defines the HAL for the Device Settings Event interface.
+ *
+ * @par Document
+ * Document reference.
+ *
+ * @par Open Issues (in no particular order)
+ * -# None
+ *
+ * @par Assumptions
+ * -# None
+ *
+ * @par Abbreviations
+ * - cb:      Callback function (suffix).
+ * - DS:      Device Settings.
+ * - HAL:     Hardware Abstraction Layer.
+ *
+ * @par Implementation Notes
+ * -# None
+ *
+ */
+
+#ifndef __DS_EVENT_H__
+#define __DS_EVENT_H__
+
+#include <stddef.h>
+#include <stdint.h>
+#include "dsError.h"
+#include "dsEventTypes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Callback function used to deliver a notification to one subscriber.
+ *
+ * @param[in] event     - Notification.  Please refer ::dsEvent_t
+ *                          Only valid for the duration of the callback; the subscriber must copy what it keeps.
+ * @param[in] userData  - Context pointer passed to dsEventSubscribe(), unmodified
+ *
+ * @pre dsEventSubscribe()
+ */
+typedef void (*dsEventCB_t)(const dsEvent_t *event, void *userData);
+
+/**
+ * @brief Initializes the DS Event sub-system.
+ *
+ * This function initializes the subscriber table. Notifications of a subsystem are only produced
+ * while that subsystem is also initialized (e.g. dsHdmiInInit() for HDMI input events).
+ *
+ * @return dsError_t                    - Status
+ * @retval dsERR_NONE                   - Success
+ * @retval dsERR_ALREADY_INITIALIZED    - Function is already initialized
+ * @retval dsERR_RESOURCE_NOT_AVAILABLE - Resources have failed to allocate
+ * @retval dsERR_GENERAL                - Underlying undefined platform error
+ *
+ * @warning  This API is Not thread safe.
+ *
+ * @post dsEventTerm() must be called to release resources.
+ *
+ * @see dsEventTerm()
+ */
+dsError_t dsEventInit(void);
+
+/**
+ * @brief Terminates the DS Event sub-system.
+ *
+ * This function removes all subscriptions, destroys all event queues, discards the events pending for dsEventDrain(),
+ * clears the mask set with dsEventSetDrainMask() and releases all resources allocated by dsEventInit().
+ * No callback is running or will be invoked once this function returns.
+ *
+ * @return dsError_t                - Status
+ * @retval dsERR_NONE               - Success
+ * @retval dsERR_NOT_INITIALIZED    - Module is not initialised
+ * @retval dsERR_GENERAL            - Underlying undefined platform error
+ *
+ * @pre dsEventInit() must be called before calling this API.
+ *
+ * @warning  This API is Not thread safe.
+ *
+ * @see dsEventInit()
+ */
+dsError_t dsEventTerm(void);
+
+/**
+ * @brief Subscribes a callback to one or more event types.
+ *
+ * Any number of subscribers, up to ::dsEVENT_MAX_SUBSCRIBERS, may subscribe to the same event type;
+ * each receives every matching event with its own @a userData. Events are delivered to subscribers
+ * in subscription order. Subscriptions coexist with the callbacks registered through the subsystem
+ * registration APIs (e.g. dsHdmiInRegisterConnectCB()), which continue to be invoked.
+ *
+ * Delivery must not take a lock that is also taken by dsEventSubscribe() or dsEventUnsubscribe();
+ * implementations should publish the subscriber table by atomic pointer exchange so that fan-out is lock-free.
+ * A new subscription receives events raised after this function returns.
+ *
+ * @param[in]  typeMask       - Bitwise OR of dsEVENT_TYPE_MASK() values of the event types to receive.
+ *                                Please refer ::dsEventType_t
+ * @param[in]  cb             - Callback function.  Please refer ::dsEventCB_t
+ * @param[in]  userData       - Context pointer passed back to @a cb. May be NULL
+ * @param[out] subscription   - Handle identifying the subscription
+ *
+ * @return dsError_t                      -  Status
+ * @retval dsERR_NONE                     -  Success
+ * @retval dsERR_NOT_INITIALIZED          -  Module is not initialised
+ * @retval dsERR_INVALID_PARAM            -  cb or subscription is NULL, or typeMask is 0 or has bits outside ::dsEVENT_TYPE_MASK_ALL
+ * @retval dsERR_RESOURCE_NOT_AVAILABLE   -  ::dsEVENT_MAX_SUBSCRIBERS subscriptions already exist
+ * @retval dsERR_GENERAL                  -  Underlying undefined platform error
+ *
+ * @pre dsEventInit() must be called before calling this API.
+ * @post dsEventUnsubscribe() must be called to remove the subscription.
+ *
+ * @note This API is thread safe and may be called from within a ::dsEventCB_t callback.
+ *
+ * @see dsEventUnsubscribe()
+ */
+dsError_t dsEventSubscribe(uint64_t typeMask, dsEventCB_t cb, void *userData, intptr_t *subscription);
+
+/**
+ * @brief Removes a subscription.
+ *
+ * Once this function returns, the callback of the subscription is not running and will not be invoked again,
+ * so the caller may release @a userData. When called from within that same callback, the callback is not
+ * invoked again after it returns.
+ *
+ * @param[in] subscription  - Handle returned by dsEventSubscribe()
+ *
+ * @return dsError_t                      -  Status
+ * @retval dsERR_NONE                     -  Success
+ * @retval dsERR_NOT_INITIALIZED          -  Module is not initialised
+ * @retval dsERR_INVALID_PARAM            -  subscription is not a current subscription
+ * @retval dsERR_GENERAL                  -  Underlying undefined platform error
+ *
+ * @pre dsEventInit() and dsEventSubscribe() must be called before calling this API.
+ *
+ * @note This API is thread safe and may be called from within a ::dsEventCB_t callback.
+ *
+ * @see dsEventSubscribe()
+ */
+dsError_t dsEventUnsubscribe(intptr_t subscription);
+
+/**
+ * @brief Creates a pollable event queue.
+ *
+ * An event queue is an alternative to dsEventSubscribe() for callers that run their own event loop.
+ * Instead of invoking a callback on a HAL thread, the HAL copies each matching event into a lock-free
+ * single-producer single-consumer ring and signals an eventfd. The caller adds that file descriptor
+ * to its own poll()/epoll() set and collects events in bulk with dsEventQueueDrain().
+ *
+ * The HAL is the single producer: it must serialize writes to a queue from its own notification context
+ * and must not block on a full queue. When the ring is full the new event is dropped and counted;
+ * please refer dsEventQueueDrain(). Queues coexist with subscriptions and with the callbacks registered
+ * through the subsystem registration APIs.
+ *
+ * @param[in]  typeMask   - Bitwise OR of dsEVENT_TYPE_MASK() values of the event types to queue.
+ *                            Please refer ::dsEventType_t
+ * @param[in]  depth      - Ring capacity in events. Must be a power of two between
+ *                            ::dsEVENT_QUEUE_MIN_DEPTH and ::dsEVENT_QUEUE_MAX_DEPTH
+ * @param[out] queue      - Handle identifying the queue
+ *
+ * @return dsError_t                      -  Status
+ * @retval dsERR_NONE                     -  Success
+ * @retval dsERR_NOT_INITIALIZED          -  Module is not initialised
+ * @retval dsERR_INVALID_PARAM            -  queue is NULL, typeMask is 0 or has bits outside ::dsEVENT_TYPE_MASK_ALL,
+ *                                            or depth is out of range or not a power of two
+ * @retval dsERR_RESOURCE_NOT_AVAILABLE   -  ::dsEVENT_MAX_QUEUES queues already exist, or the ring or eventfd could not be allocated
+ * @retval dsERR_GENERAL                  -  Underlying undefined platform error
+ *
+ * @pre dsEventInit() must be called before calling this API.
+ * @post dsEventQueueDestroy() must be called to release the queue.
+ *
+ * @warning  This API is Not thread safe.
+ *
+ * @see dsEventQueueGetFd(), dsEventQueueDrain(), dsEventQueueDestroy()
+ */
+dsError_t dsEventQueueCreate(uint64_t typeMask, uint32_t depth, intptr_t *queue);
+
+/**
+ * @brief Gets the file descriptor that signals a non-empty event queue.
+ *
+ * The descriptor is an eventfd which becomes readable (POLLIN) when the queue goes from empty to non-empty,
+ * and stays readable until dsEventQueueDrain() resets it. Please refer dsEventQueueDrain() for the required
+ * order of the reset and the copy.
+ * It is owned by the HAL: the caller must not read from, write to or close it. It remains valid until
+ * dsEventQueueDestroy() is called for the queue.
+ *
+ * @param[in]  queue   - Handle returned by dsEventQueueCreate()
+ * @param[out] fd      - Pollable file descriptor of the queue
+ *
+ * @return dsError_t                      -  Status
+ * @retval dsERR_NONE                     -  Success
+ * @retval dsERR_NOT_INITIALIZED          -  Module is not initialised
+ * @retval dsERR_INVALID_PARAM            -  queue is not a current queue, or fd is NULL
+ * @retval dsERR_GENERAL                  -  Underlying undefined platform error
+ *
+ * @pre dsEventInit() and dsEventQueueCreate() must be called before calling this API.
+ *
+ * @warning  This API is Not thread safe.
+ *
+ * @see dsEventQueueCreate(), dsEventQueueDrain()
+ */
+dsError_t dsEventQueueGetFd(intptr_t queue, int *fd);
+
+/**
+ * @brief Removes queued events, oldest first.
+ *
+ * Copies up to @a maxEvents events out of the queue without blocking. The only system calls made are the read
+ * that resets the eventfd and, when the re-check below finds an unsignalled event, the write that signals it
+ * again. To avoid losing a wakeup, the implementation must reset (read) the eventfd before it
+ * copies any event out of the ring, never after. After publishing its new read position it must re-check the ring,
+ * and signal the eventfd again if an event was added that the producer did not signal because it saw the ring
+ * non-empty. An event queued at any time during or after this call therefore either is returned in @a events
+ * or leaves the eventfd readable. The caller must call this API repeatedly while @a count equals
+ * @a maxEvents. There must be a single consumer thread per queue.
+ *
+ * @param[in]  queue       - Handle returned by dsEventQueueCreate()
+ * @param[out] events      - Caller-allocated array of at least @a maxEvents events.  Please refer ::dsEvent_t
+ * @param[in]  maxEvents   - Capacity of @a events. Must be greater than 0
+ * @param[out] count       - Number of events copied into @a events. 0 if the queue is empty
+ * @param[out] dropped     - Number of events dropped because the queue was full since the previous call. May be NULL
+ *
+ * @return dsError_t                      -  Status
+ * @retval dsERR_NONE                     -  Success
+ * @retval dsERR_NOT_INITIALIZED          -  Module is not initialised
+ * @retval dsERR_INVALID_PARAM            -  queue is not a current queue, events or count is NULL, or maxEvents is 0
+ * @retval dsERR_GENERAL                  -  Underlying undefined platform error
+ *
+ * @pre dsEventInit() and dsEventQueueCreate() must be called before calling this API.
+ *
+ * @warning  This API is Not thread safe.
+ *
+ * @see dsEventQueueCreate(), dsEventQueueGetFd()
+ */
+dsError_t dsEventQueueDrain(intptr_t queue, dsEvent_t *events, uint32_t maxEvents, uint32_t *count, uint32_t *dropped);
+
+/**
+ * @brief Destroys an event queue.
+ *
+ * Discards any queued events, closes the eventfd of the queue and releases the ring. No further events
+ * are written to the queue once this function returns.
+ *
+ * @param[in] queue  - Handle returned by dsEventQueueCreate()
+ *
+ * @return dsError_t                      -  Status
+ * @retval dsERR_NONE                     -  Success
+ * @retval dsERR_NOT_INITIALIZED          -  Module is not initialised
+ * @retval dsERR_INVALID_PARAM            -  queue is not a current queue
+ * @retval dsERR_GENERAL                  -  Underlying undefined platform error
+ *
+ * @pre dsEventInit() and dsEventQueueCreate() must be called before calling this API.
+ *
+ * @warning  This API is Not thread safe.
+ *
+ * @see dsEventQueueCreate()
+ */
+dsError_t dsEventQueueDestroy(intptr_t queue);
+
+/**
+ * @brief Sets the debounce window of an event type.
+ *
+ * While a window is set, an event is not delivered when it is raised. It is held until no further event
+ * of the same type from the same source has been raised for @a windowMs milliseconds, or until @a maxHoldMs
+ * milliseconds have passed since the first held event of the burst, whichever comes first. Only the last event
+ * (the latest state) is then delivered, with ::dsEvent_t::coalescedCount set to the number of events it
+ * replaced. The maximum hold time guarantees that a source which keeps changing more often than @a windowMs
+ * (e.g. a flapping cable) is still reported periodically. An event raised after a delivery starts a new burst.
+ * The delivered state may equal the state delivered before the burst; the non-zero count tells
+ * the caller that transitions were suppressed.
+ *
+ * The source of an event is:
+ *  - the port, for the HDMI input and composite input event types whose payload carries a port;
+ *  - the display handle, for ::dsEVENT_TYPE_DISPLAY;
+ *  - the audio port type and number, for ::dsEVENT_TYPE_AUDIO_OUT_CONNECT;
+ *  - the video port handle, for ::dsEVENT_TYPE_VIDEO_HDCP_STATUS and ::dsEVENT_TYPE_VIDEO_OUTPUT_SETTINGS_CHANGE;
+ *  - the event type itself, for every other event type. These single-source types include
+ *    ::dsEVENT_TYPE_HDMI_IN_STATUS_CHANGE, ::dsEVENT_TYPE_HDMI_IN_AV_LATENCY_CHANGE and
+ *    ::dsEVENT_TYPE_COMPOSITE_IN_STATUS_CHANGE, whose payloads carry no port.
+ *
+ * For ::dsEVENT_TYPE_DISPLAY only dsDISPLAY_EVENT_CONNECTED and dsDISPLAY_EVENT_DISCONNECTED are debounced.
+ * Other display events are not coalesced. They are delivered immediately unless a hot plug event of the same
+ * display handle is held; they are then held behind it and delivered right after it, in ::dsEvent_t::sequence
+ * order, so that the display events of one handle are never delivered out of order.
+ *
+ * A specific @a port is only accepted for the event types whose source is a port. Setting a window with
+ * ::dsEVENT_PORT_ALL applies it to every source of the type and clears any window previously set for a
+ * specific port of that type. A window set afterwards for a specific port, including 0, overrides the
+ * ::dsEVENT_PORT_ALL window for that port only.
+ *
+ * Debouncing applies to subscriptions, event queues and the pending buffer of dsEventDrain(): a held event is
+ * only copied to them when it is delivered, with the same ::dsEvent_t::coalescedCount. The callbacks registered
+ * through the subsystem registration APIs are not affected. Debouncing is disabled for all event types after dsEventInit().
+ *
+ * @param[in] type      - Event type.  Please refer ::dsEventType_t
+ * @param[in] port      - Port index of an HDMI input or composite input event type whose payload carries a port
+ *                          (::dsHdmiInPort_t, ::dsCompositeInPort_t), or ::dsEVENT_PORT_ALL.
+ *                          Must be ::dsEVENT_PORT_ALL for all other event types
+ * @param[in] windowMs  - Quiet period in milliseconds, up to ::dsEVENT_MAX_DEBOUNCE_WINDOW_MS. 0 disables debouncing
+ * @param[in] maxHoldMs - Maximum time in milliseconds an event is held, from @a windowMs up to ::dsEVENT_MAX_DEBOUNCE_HOLD_MS.
+ *                          Ignored when @a windowMs is 0
+ *
+ * @return dsError_t                      -  Status
+ * @retval dsERR_NONE                     -  Success
+ * @retval dsERR_NOT_INITIALIZED          -  Module is not initialised
+ * @retval dsERR_INVALID_PARAM            -  type is invalid, port is invalid for type, or windowMs or maxHoldMs is out of range
+ * @retval dsERR_GENERAL                  -  Underlying undefined platform error
+ *
+ * @pre dsEventInit() must be called before calling this API.
+ *
+ * @warning  This API is Not thread safe.
+ *
+ * @see dsEventGetDebounce()
+ */
+dsError_t dsEventSetDebounce(dsEventType_t type, int32_t port, uint32_t windowMs, uint32_t maxHoldMs);
+
+/**
+ * @brief Gets the debounce window of an event type.
+ *
+ * @param[in]  type      - Event type.  Please refer ::dsEventType_t
+ * @param[in]  port      - Port index, or ::dsEVENT_PORT_ALL. As dsEventSetDebounce()
+ * @param[out] windowMs  - Quiet period in milliseconds in effect for @a port, taking a port specific window
+ *                           over the ::dsEVENT_PORT_ALL window. 0 if debouncing is disabled
+ * @param[out] maxHoldMs - Maximum hold time in milliseconds in effect for @a port. 0 if debouncing is disabled
+ *
+ * @return dsError_t                      -  Status
+ * @retval dsERR_NONE                     -  Success
+ * @retval dsERR_NOT_INITIALIZED          -  Module is not initialised
+ * @retval dsERR_INVALID_PARAM            -  type is invalid, port is invalid for type, or windowMs or maxHoldMs is NULL
+ * @retval dsERR_GENERAL                  -  Underlying undefined platform error
+ *
+ * @pre dsEventInit() must be called before calling this API.
+ *
+ * @warning  This API is Not thread safe.
+ *
+ * @see dsEventSetDebounce()
+ */
+dsError_t dsEventGetDebounce(dsEventType_t type, int32_t port, uint32_t *windowMs, uint32_t *maxHoldMs);
+
+/**
+ * @brief Sets the number of threads that invoke subscriber callbacks.
+ *
+ * With a single worker, which is the default after dsEventInit(), all callbacks are invoked from one thread
+ * in event order and a slow callback delays every other event. With more workers, events from independent
+ * sources are dispatched in parallel. Ordering is guaranteed per (event type, source): the events of one type
+ * from one source are delivered to every subscriber in ::dsEvent_t::sequence order. The source of an event is
+ * as defined for dsEventSetDebounce(). An event held by dsEventSetDebounce() keeps the sequence number assigned
+ * when it was raised; a later event of its type and source is either coalesced into it or, for the display events
+ * that are not debounced, held behind it. No order is guaranteed between different event types, even from the
+ * same source: a held event does not delay the other event types of its source. A callback may therefore be
+ * invoked concurrently for events of different types or sources, and must be reentrant when more than one worker
+ * is set. Callers that need to order events of different types use ::dsEvent_t::sequence.
+ *
+ * Event queues created with dsEventQueueCreate() are not affected.
+ *
+ * @param[in] workerCount   - Number of worker threads, from 1 to ::dsEVENT_MAX_DISPATCH_WORKERS
+ *
+ * @return dsError_t                      -  Status
+ * @retval dsERR_NONE                     -  Success
+ * @retval dsERR_NOT_INITIALIZED          -  Module is not initialised
+ * @retval dsERR_INVALID_PARAM            -  workerCount is out of range
+ * @retval dsERR_RESOURCE_NOT_AVAILABLE   -  Worker threads could not be created
+ * @retval dsERR_GENERAL                  -  Underlying undefined platform error
+ *
+ * @pre dsEventInit() must be called before calling this API.
+ *
+ * @warning  This API is Not thread safe and must not be called from within a ::dsEventCB_t callback.
+ *
+ * @see dsEventGetDispatchStats()
+ */
+dsError_t dsEventSetDispatchWorkers(uint32_t workerCount);
+
+/**
+ * @brief Gets the statistics of the callback dispatcher.
+ *
+ * @param[out] stats    - Dispatcher statistics.  Please refer ::dsEventDispatchStats_t
+ *
+ * @return dsError_t                      -  Status
+ * @retval dsERR_NONE                     -  Success
+ * @retval dsERR_NOT_INITIALIZED          -  Module is not initialised
+ * @retval dsERR_INVALID_PARAM            -  stats is NULL
+ * @retval dsERR_GENERAL                  -  Underlying undefined platform error
+ *
+ * @pre dsEventInit() must be called before calling this API.
+ *
+ * @note This API is thread safe.
+ *
+ * @see dsEventSetDispatchWorkers(), dsEventGetSubscriptionStats()
+ */
+dsError_t dsEventGetDispatchStats(dsEventDispatchStats_t *stats);
+
+/**
+ * @brief Gets the callback statistics of a subscription.
+ *
+ * Allows a slow subscriber, which delays the other subscribers of the same source, to be identified.
+ *
+ * @param[in]  subscription - Handle returned by dsEventSubscribe()
+ * @param[out] stats        - Subscription statistics.  Please refer ::dsEventSubscriptionStats_t
+ *
+ * @return dsError_t                      -  Status
+ * @retval dsERR_NONE                     -  Success
+ * @retval dsERR_NOT_INITIALIZED          -  Module is not initialised
+ * @retval dsERR_INVALID_PARAM            -  subscription is not a current subscription, or stats is NULL
+ * @retval dsERR_GENERAL                  -  Underlying undefined platform error
+ *
+ * @pre dsEventInit() and dsEventSubscribe() must be called before calling this API.
+ *
+ * @note This API is thread safe.
+ *
+ * @see dsEventGetDispatchStats()
+ */
+dsError_t dsEventGetSubscriptionStats(intptr_t subscription, dsEventSubscriptionStats_t *stats);
+
+/**
+ * @brief Selects the event types held for dsEventDrain().
+ *
+ * For callers that poll, the HAL keeps a pending buffer of ::dsEVENT_QUEUE_MAX_DEPTH events of the selected types,
+ * to be collected in batches with dsEventDrain(). When the buffer is full, new events are dropped and counted in
+ * ::dsEventDispatchStats_t::drainDroppedCount. No event is held after dsEventInit() until this function is called.
+ * The pending buffer coexists with subscriptions and with the queues created with dsEventQueueCreate().
+ * Events are debounced as set with dsEventSetDebounce() before they enter the pending buffer; a drained event
+ * reports in ::dsEvent_t::coalescedCount the number of events of its type and source that it replaced.
+ *
+ * @param[in] typeMask  - Bitwise OR of dsEVENT_TYPE_MASK() values of the event types to hold.
+ *                          Please refer ::dsEventType_t.  0 stops holding events and discards pending events
+ *
+ * @return dsError_t                      -  Status
+ * @retval dsERR_NONE                     -  Success
+ * @retval dsERR_NOT_INITIALIZED          -  Module is not initialised
+ * @retval dsERR_INVALID_PARAM            -  typeMask has bits outside ::dsEVENT_TYPE_MASK_ALL
+ * @retval dsERR_GENERAL                  -  Underlying undefined platform error
+ *
+ * @pre dsEventInit() must be called before calling this API.
+ *
+ * @warning  This API is Not thread safe.
+ *
+ * @see dsEventDrain()
+ */
+dsError_t dsEventSetDrainMask(uint64_t typeMask);
+
+/**
+ * @brief Removes pending events in one batch, oldest first.
+ *
+ * Copies up to @a max pending events of the types selected with dsEventSetDrainMask() into @a out, without blocking.
+ * A single call collects the notifications of all subsystems (HDMI input, composite input, display, audio and
+ * video), so that bursts of events during boot or hot plug cost one call rather than one callback per event.
+ * The caller must call this API repeatedly while @a count equals @a max.
+ *
+ * @param[out] out      - Caller-allocated array of at least @a max events.  Please refer ::dsEvent_t
+ * @param[in]  max      - Capacity of @a out. Must be greater than 0
+ * @param[out] count    - Number of events copied into @a out. 0 if no event is pending
+ *
+ * @return dsError_t                      -  Status
+ * @retval dsERR_NONE                     -  Success
+ * @retval dsERR_NOT_INITIALIZED          -  Module is not initialised
+ * @retval dsERR_INVALID_PARAM            -  out or count is NULL, or max is 0
+ * @retval dsERR_GENERAL                  -  Underlying undefined platform error
+ *
+ * @pre dsEventInit() and dsEventSetDrainMask() must be called before calling this API.
+ *
+ * @warning  This API is Not thread safe.
+ *
+ * @see dsEventSetDrainMask(), dsEventQueueDrain()
+ */
+dsError_t dsEventDrain(dsEvent_t *out, size_t max, size_t *count);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* __DS_EVENT_H__ */
+
+/** @} */ // End of DS HAL Event Public APIs
+/** @} */ // End of DS Event HAL
+/** @} */ // End of Device Settings HAL
+/** @} */ // End of Device Settings Module
+/** @} */ // End of HPK
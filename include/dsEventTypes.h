@@ -0,0 +1,323 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2026 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+/**
+ * @addtogroup HPK Hardware Porting Kit
+ * @{
+ * @par The Hardware Porting Kit
+ * HPK is the next evolution of the well-defined Hardware Abstraction Layer
+ * (HAL), but augmented with more comprehensive documentation and test suites
+ * that OEM or SOC vendors can use to self-certify their ports before taking
+ * them to RDKM for validation or to an operator for final integration and
+ * deployment. The Hardware Porting Kit effectively enables an OEM and/or SOC
+ * vendor to self-certify their own Video Accelerator devices, with minimal RDKM
+ * assistance.
+ *
+ */
+
+/** @addtogroup Device_Settings Device Settings Module
+ * @{
+ */
+
+/** @addtogroup Device_Settings_HAL Device Settings HAL
+ * @par Application API Specification
+ * Described herein are the DeviceSettings HAL types and functions that are part of
+ * the Event subsystem. The Event subsystem delivers the notifications of all other DS HAL subsystems.
+ *  @{
+ */
+
+/** @addtogroup dsEvent_HAL DS Event HAL
+ *  @{
+ * @par Application API Specification
+ * dsEvent HAL provides an interface for subscribing to the notifications of the device settings module
+ */
+
+/** @defgroup DSHAL_EVENT_TYPES DS HAL Event Type Definitions
+ *  @ingroup dsEvent_HAL
+ *  @{
+ */
+
+/**
+ * @file dsEventTypes.h
+ *
+ * @brief Device Setting Event HAL types.
+ *
+ * This file defines the types used by the DS Event HAL Submodule.
+ *
+ * @par Document
+ * Document reference.
+ *
+ * @par Open Issues (in no particular order)
+ * -# None
+ *
+ * @par Assumptions
+ * -# None
+ *
+ * @par Abbreviations
+ * - HAL:     Hardware Abstraction Layer.
+ * - DS:      Device Settings.
+ * - HDMI:    High-Definition Multimedia Interface
+ * - HDCP:    High-bandwidth Digital Content Protection
+ * - ALLM:    Auto Low Latency Mode
+ * - AVI:     Auxiliary Video Information
+ * - VRR:     Variable Refresh Rate
+ *
+ * @par Implementation Notes
+ * -# None
+ *
+ */
+
+#ifndef __DS_EVENT_TYPES_H__
+#define __DS_EVENT_TYPES_H__
+
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#include "dsError.h"
+#include "dsAVDTypes.h"
+#include "dsHdmiInTypes.h"
+#include "dsCompositeInTypes.h"
+#include "dsDisplay.h"
+
+/**
+ * @brief This enumeration defines the notifications delivered through the DS Event HAL.
+ * Each value corresponds to one of the subsystem callbacks, named in the description.
+ * New event types are only ever added before dsEVENT_TYPE_MAX.
+ * @see dsEventType_isValid
+ */
+typedef enum _dsEventType_t {
+    dsEVENT_TYPE_HDMI_IN_CONNECT = 0,               ///< HDMI input hot plug.  As ::dsHdmiInConnectCB_t
+    dsEVENT_TYPE_HDMI_IN_SIGNAL_CHANGE,             ///< HDMI input signal status.  As ::dsHdmiInSignalChangeCB_t
+    dsEVENT_TYPE_HDMI_IN_STATUS_CHANGE,             ///< HDMI input status.  As ::dsHdmiInStatusChangeCB_t
+    dsEVENT_TYPE_HDMI_IN_VIDEO_MODE_UPDATE,         ///< HDMI input video mode.  As ::dsHdmiInVideoModeUpdateCB_t
+    dsEVENT_TYPE_HDMI_IN_ALLM_CHANGE,               ///< HDMI input ALLM mode.  As ::dsHdmiInAllmChangeCB_t
+    dsEVENT_TYPE_HDMI_IN_AV_LATENCY_CHANGE,         ///< HDMI input AV latency.  As ::dsAVLatencyChangeCB_t
+    dsEVENT_TYPE_HDMI_IN_AVI_CONTENT_TYPE_CHANGE,   ///< HDMI input AVI content type.  As ::dsHdmiInAviContentTypeChangeCB_t
+    dsEVENT_TYPE_HDMI_IN_VRR_CHANGE,                ///< HDMI input VRR type.  As ::dsHdmiInVRRChangeCB_t
+    dsEVENT_TYPE_COMPOSITE_IN_CONNECT,              ///< Composite input hot plug.  As ::dsCompositeInConnectCB_t
+    dsEVENT_TYPE_COMPOSITE_IN_SIGNAL_CHANGE,        ///< Composite input signal status.  As ::dsCompositeInSignalChangeCB_t
+    dsEVENT_TYPE_COMPOSITE_IN_STATUS_CHANGE,        ///< Composite input status.  As ::dsCompositeInStatusChangeCB_t
+    dsEVENT_TYPE_COMPOSITE_IN_VIDEO_MODE_UPDATE,    ///< Composite input video mode.  As ::dsCompositeInVideoModeUpdateCB_t
+    dsEVENT_TYPE_DISPLAY,                           ///< Display event.  As ::dsDisplayEventCallback_t
+    dsEVENT_TYPE_AUDIO_OUT_CONNECT,                 ///< Audio output connection.  As ::dsAudioOutPortConnectCB_t
+    dsEVENT_TYPE_AUDIO_FORMAT_UPDATE,               ///< Audio format.  As ::dsAudioFormatUpdateCB_t
+    dsEVENT_TYPE_AUDIO_ATMOS_CAPS_CHANGE,           ///< Sink ATMOS capability.  As ::dsAtmosCapsChangeCB_t
+    dsEVENT_TYPE_VIDEO_FORMAT_UPDATE,               ///< Video format.  As ::dsVideoFormatUpdateCB_t
+    dsEVENT_TYPE_VIDEO_HDCP_STATUS,                 ///< Video port HDCP status.  As ::dsHDCPStatusCallback_t
+    dsEVENT_TYPE_VIDEO_FRAMERATE_PRE_CHANGE,        ///< Display frame rate about to change.  As ::dsRegisterFrameratePreChangeCB_t
+    dsEVENT_TYPE_VIDEO_FRAMERATE_POST_CHANGE,       ///< Display frame rate changed.  As ::dsRegisterFrameratePostChangeCB_t
+    dsEVENT_TYPE_VIDEO_OUTPUT_SETTINGS_CHANGE,      ///< Video port output settings.  As ::dsOutputSettingsChangeCallback_t
+    dsEVENT_TYPE_HDMI_IN_INFOFRAME_CHANGE,          ///< HDMI input InfoFrames.  As ::dsHdmiInInfoFrameChangeCB_t
+    dsEVENT_TYPE_HDMI_IN_GAME_MODE_COMPLETE,        ///< HDMI input game mode transition complete.  As ::dsHdmiInGameModeCompleteCB_t
+    dsEVENT_TYPE_MAX                                ///< Out of range
+} dsEventType_t;
+
+/**
+ * @brief Event type validation check.
+ * @see dsEventType_t
+ */
+#define dsEventType_isValid(t)  (((t) >= dsEVENT_TYPE_HDMI_IN_CONNECT ) && ((t) < dsEVENT_TYPE_MAX))
+
+/**
+ * @brief Bit of an event type in a uint64_t event type mask.
+ * @see dsEventType_t
+ */
+#define dsEVENT_TYPE_MASK(t)  (((uint64_t)1) << (t))
+
+/**
+ * @brief Event type mask selecting every event type.
+ */
+#define dsEVENT_TYPE_MASK_ALL  (dsEVENT_TYPE_MASK(dsEVENT_TYPE_MAX) - 1)
+
+/**
+ * @brief Maximum number of concurrent subscriptions the HAL must support.
+ */
+#define dsEVENT_MAX_SUBSCRIBERS 16
+
+/**
+ * @brief Maximum number of concurrent event queues the HAL must support.
+ * @see dsEventQueueCreate()
+ */
+#define dsEVENT_MAX_QUEUES 4
+
+/**
+ * @brief Minimum depth, in events, of an event queue.
+ */
+#define dsEVENT_QUEUE_MIN_DEPTH 16
+
+/**
+ * @brief Maximum depth, in events, of an event queue.
+ */
+#define dsEVENT_QUEUE_MAX_DEPTH 1024
+
+/**
+ * @brief Port value that applies a setting to every source of an event type.
+ * @see dsEventSetDebounce()
+ */
+#define dsEVENT_PORT_ALL (-1)
+
+/**
+ * @brief Maximum debounce window, in milliseconds.
+ * @see dsEventSetDebounce()
+ */
+#define dsEVENT_MAX_DEBOUNCE_WINDOW_MS 5000
+
+/**
+ * @brief Maximum debounce hold time, in milliseconds.
+ * @see dsEventSetDebounce()
+ */
+#define dsEVENT_MAX_DEBOUNCE_HOLD_MS 30000
+
+/**
+ * @brief Maximum number of dispatch worker threads.
+ * @see dsEventSetDispatchWorkers()
+ */
+#define dsEVENT_MAX_DISPATCH_WORKERS 8
+
+/**
+ * @brief Structure that holds one notification.
+ * @c type selects the member of @c data that is valid. Members carry the same values as the
+ * parameters of the corresponding subsystem callback.
+ * @c timestampNs and @c sequence allow the caller to measure delivery latency and to order
+ * events of different subsystems (e.g. an HDCP status change relative to a resolution change).
+ * @note Used in @link dsEvent.h @endlink
+ */
+typedef struct _dsEvent_t {
+    dsEventType_t type;                                 ///< Event type.  Please refer ::dsEventType_t
+    union {
+        struct {
+            dsHdmiInPort_t port;                        ///< HDMI input port.  Please refer ::dsHdmiInPort_t
+            bool isPortConnected;                       ///< Connection status ( @a true if connected, @a false otherwise)
+        } hdmiInConnect;                                ///< Valid for dsEVENT_TYPE_HDMI_IN_CONNECT
+        struct {
+            dsHdmiInPort_t port;                        ///< HDMI input port.  Please refer ::dsHdmiInPort_t
+            dsHdmiInSignalStatus_t sigStatus;           ///< Signal status.  Please refer ::dsHdmiInSignalStatus_t
+        } hdmiInSignalChange;                           ///< Valid for dsEVENT_TYPE_HDMI_IN_SIGNAL_CHANGE
+        dsHdmiInStatus_t hdmiInStatus;                  ///< Valid for dsEVENT_TYPE_HDMI_IN_STATUS_CHANGE
+        struct {
+            dsHdmiInPort_t port;                        ///< HDMI input port.  Please refer ::dsHdmiInPort_t
+            dsVideoPortResolution_t videoResolution;    ///< Video mode.  Please refer ::dsVideoPortResolution_t
+        } hdmiInVideoMode;                              ///< Valid for dsEVENT_TYPE_HDMI_IN_VIDEO_MODE_UPDATE
+        struct {
+            dsHdmiInPort_t port;                        ///< HDMI input port.  Please refer ::dsHdmiInPort_t
+            bool allmMode;                              ///< ALLM mode ( @a true if enabled, @a false otherwise)
+        } hdmiInAllm;                                   ///< Valid for dsEVENT_TYPE_HDMI_IN_ALLM_CHANGE
+        struct {
+            int audioLatency;                           ///< Audio latency in ms. Max value 500ms. Min value 0
+            int videoLatency;                           ///< Video latency in ms. Max value 500ms. Min value 0
+        } hdmiInAVLatency;                              ///< Valid for dsEVENT_TYPE_HDMI_IN_AV_LATENCY_CHANGE
+        struct {
+            dsHdmiInPort_t port;                        ///< HDMI input port.  Please refer ::dsHdmiInPort_t
+            dsAviContentType_t contentType;             ///< AVI content type.  Please refer ::dsAviContentType_t
+        } hdmiInAviContentType;                         ///< Valid for dsEVENT_TYPE_HDMI_IN_AVI_CONTENT_TYPE_CHANGE
+        struct {
+            dsHdmiInPort_t port;                        ///< HDMI input port.  Please refer ::dsHdmiInPort_t
+            dsVRRType_t vrrType;                        ///< VRR type.  Please refer ::dsVRRType_t
+        } hdmiInVrr;                                    ///< Valid for dsEVENT_TYPE_HDMI_IN_VRR_CHANGE
+        struct {
+            dsCompositeInPort_t port;                   ///< Composite input port.  Please refer ::dsCompositeInPort_t
+            bool isPortConnected;                       ///< Connection status ( @a true if connected, @a false otherwise)
+        } compositeInConnect;                           ///< Valid for dsEVENT_TYPE_COMPOSITE_IN_CONNECT
+        struct {
+            dsCompositeInPort_t port;                   ///< Composite input port.  Please refer ::dsCompositeInPort_t
+            dsCompInSignalStatus_t sigStatus;           ///< Signal status.  Please refer ::dsCompInSignalStatus_t
+        } compositeInSignalChange;                      ///< Valid for dsEVENT_TYPE_COMPOSITE_IN_SIGNAL_CHANGE
+        dsCompositeInStatus_t compositeInStatus;        ///< Valid for dsEVENT_TYPE_COMPOSITE_IN_STATUS_CHANGE
+        struct {
+            dsCompositeInPort_t port;                   ///< Composite input port.  Please refer ::dsCompositeInPort_t
+            dsVideoPortResolution_t videoResolution;    ///< Video mode.  Please refer ::dsVideoPortResolution_t
+        } compositeInVideoMode;                         ///< Valid for dsEVENT_TYPE_COMPOSITE_IN_VIDEO_MODE_UPDATE
+        struct {
+            intptr_t handle;                            ///< Handle of the display device
+            dsDisplayEvent_t event;                     ///< Display event.  Please refer ::dsDisplayEvent_t
+        } display;                                      ///< Valid for dsEVENT_TYPE_DISPLAY. The optional eventData of ::dsDisplayEventCallback_t is not carried
+        struct {
+            dsAudioPortType_t portType;                 ///< Audio port type.  Please refer ::dsAudioPortType_t
+            unsigned int portNo;                        ///< Audio port number
+            bool isPortConnected;                       ///< Connection status ( @a true if connected, @a false otherwise)
+        } audioOutConnect;                              ///< Valid for dsEVENT_TYPE_AUDIO_OUT_CONNECT
+        dsAudioFormat_t audioFormat;                    ///< Valid for dsEVENT_TYPE_AUDIO_FORMAT_UPDATE.  Please refer ::dsAudioFormat_t
+        struct {
+            dsATMOSCapability_t atmosCaps;              ///< ATMOS capability.  Please refer ::dsATMOSCapability_t
+            bool status;                                ///< ATMOS capability status ( @a true if enabled, @a false otherwise)
+        } audioAtmosCaps;                               ///< Valid for dsEVENT_TYPE_AUDIO_ATMOS_CAPS_CHANGE
+        dsHDRStandard_t videoFormat;                    ///< Valid for dsEVENT_TYPE_VIDEO_FORMAT_UPDATE.  Please refer ::dsHDRStandard_t
+        struct {
+            intptr_t handle;                            ///< Handle of the video port
+            dsHdcpStatus_t status;                      ///< HDCP status.  Please refer ::dsHdcpStatus_t
+        } videoHdcpStatus;                              ///< Valid for dsEVENT_TYPE_VIDEO_HDCP_STATUS
+        struct {
+            unsigned int tSecond;                       ///< Time in seconds, as the frame rate change callbacks
+        } videoFramerateChange;                         ///< Valid for dsEVENT_TYPE_VIDEO_FRAMERATE_PRE_CHANGE and dsEVENT_TYPE_VIDEO_FRAMERATE_POST_CHANGE
+        struct {
+            intptr_t handle;                            ///< Handle of the video port
+            dsVideoPortOutputSettings_t settings;       ///< New output settings.  Please refer ::dsVideoPortOutputSettings_t
+        } videoOutputSettings;                          ///< Valid for dsEVENT_TYPE_VIDEO_OUTPUT_SETTINGS_CHANGE
+        struct {
+            dsHdmiInPort_t port;                        ///< HDMI input port.  Please refer ::dsHdmiInPort_t
+            uint32_t changedMask;                       ///< Bitwise OR of the ::dsHdmiInInfoFrameType_t values that changed
+        } hdmiInInfoFrame;                              ///< Valid for dsEVENT_TYPE_HDMI_IN_INFOFRAME_CHANGE. The InfoFrames are read with dsHdmiInGetInfoFrames()
+        struct {
+            dsHdmiInPort_t port;                        ///< HDMI input port.  Please refer ::dsHdmiInPort_t
+            dsError_t status;                           ///< Transition status.  As ::dsHdmiInGameModeCompleteCB_t
+            dsHdmiInGameModeResult_t result;            ///< Transition result.  Please refer ::dsHdmiInGameModeResult_t
+        } hdmiInGameMode;                               ///< Valid for dsEVENT_TYPE_HDMI_IN_GAME_MODE_COMPLETE
+    } data;                                             ///< Event payload, selected by @c type
+    uint32_t coalescedCount;                            ///< Number of earlier events of the same type and source that were
+                                                        ///< suppressed by debouncing in favour of this one. 0 if none
+    uint64_t timestampNs;                               ///< CLOCK_MONOTONIC time, in nanoseconds, at which the HAL detected the change
+    uint64_t sequence;                                  ///< Sequence number assigned when the event is raised, unique and
+                                                        ///< increasing across all event types. A receiver sees gaps for events of types
+                                                        ///< outside its type mask as well as for coalesced or dropped events, so a gap
+                                                        ///< alone does not indicate a lost event; use ::dsEvent_t::coalescedCount and
+                                                        ///< the dropped counts to detect those
+} dsEvent_t;
+
+/**
+ * @brief Structure that holds the statistics of the callback dispatcher.
+ * Counters are cumulative since dsEventInit().
+ * @note Used in @link dsEvent.h @endlink
+ */
+typedef struct _dsEventDispatchStats_t {
+    uint32_t workerCount;           ///< Current number of dispatch worker threads
+    uint32_t queueDepth;            ///< Number of events currently waiting for dispatch
+    uint32_t maxQueueDepth;         ///< Highest number of events waiting for dispatch
+    uint64_t dispatchedCount;       ///< Number of events dispatched to subscribers
+    uint64_t drainDroppedCount;     ///< Number of events dropped because the pending buffer of dsEventDrain() was full
+} dsEventDispatchStats_t;
+
+/**
+ * @brief Structure that holds the callback statistics of one subscription.
+ * Counters are cumulative since dsEventSubscribe().
+ * @note Used in @link dsEvent.h @endlink
+ */
+typedef struct _dsEventSubscriptionStats_t {
+    uint64_t callbackCount;         ///< Number of times the callback was invoked
+    uint64_t totalRuntimeNs;        ///< Total time spent in the callback, in nanoseconds
+    uint64_t maxRuntimeNs;          ///< Longest single invocation of the callback, in nanoseconds
+    uint64_t maxDispatchDelayNs;    ///< Longest time from ::dsEvent_t::timestampNs to the start of an invocation, in nanoseconds
+} dsEventSubscriptionStats_t;
+
+#endif /* __DS_EVENT_TYPES_H__ */
+
+/** @} */ // End of DSHAL_EVENT_TYPES
+/** @} */ // End of DS Event HAL
+/** @} */ // End of Device Settings HAL
+/** @} */ // End of Device Settings Module
+/** @} */ // End of HPK
@@ -187,6 +187,40 @@ dsError_t dsHdmiInGetNumberOfInputs (uint8_t *pNumberOfinputs);
  */
 dsError_t dsHdmiInGetStatus (dsHdmiInStatus_t *pStatus); 
 
+/**
+ * @brief Gets the HDMI input ports whose status changed since a given generation
+ *
+ * The HAL keeps a status generation, incremented on every change of the connection, signal status or video mode of any port,
+ * and records for each port the generation of its last change. This function returns the current generation and the new
+ * state of only those ports changed after @a sinceGeneration, so that a caller refreshing its view after a status callback
+ * does not need to diff the whole ::dsHdmiInStatus_t. The cost is proportional to the number of ports and no memory is allocated.
+ *
+ * The generation never goes backwards: it is not reset by dsHdmiInTerm() and dsHdmiInInit() within the life of the process,
+ * and a re-initialisation counts as a change of every port. If @a sinceGeneration is greater than the current generation
+ * (e.g. it was obtained in another process), every port is returned, as for 0.
+ *
+ * For sink devices, this function gets the status changes of the HDMI input ports.
+ * For source devices, this function returns dsERR_OPERATION_NOT_SUPPORTED always.
+ *
+ * @param[in]  sinceGeneration  - Generation returned by a previous call. 0, or a value greater than the current
+ *                                  generation, returns the state of every port
+ * @param[out] pDelta           - Status changes.  Please refer ::dsHdmiInStatusDelta_t
+ *
+ * @return dsError_t                        - Status
+ * @retval dsERR_NONE                       - Success
+ * @retval dsERR_NOT_INITIALIZED            - Module is not initialised
+ * @retval dsERR_INVALID_PARAM              - Parameter passed to this function is invalid
+ * @retval dsERR_OPERATION_NOT_SUPPORTED    - The attempted operation is not supported; e.g: source devices
+ * @retval dsERR_OPERATION_FAILED           - The attempted operation has failed
+ *
+ * @pre dsHdmiInInit() must be called before calling this API.
+ *
+ * @warning  This API is Not thread safe.
+ *
+ * @see dsHdmiInGetStatus()
+ */
+dsError_t dsHdmiInGetStatusDelta (uint32_t sinceGeneration, dsHdmiInStatusDelta_t *pDelta);
+
 /**
  * @brief Selects the HDMI input port as active and available for presentation
  * 
@@ -220,6 +254,62 @@ dsError_t dsHdmiInGetStatus (dsHdmiInStatus_t *pStatus);
  */
 dsError_t dsHdmiInSelectPort (dsHdmiInPort_t Port, bool audioMix, dsVideoPlaneType_t evideoPlaneType,bool topMost);
 
+/**
+ * @brief Enables or disables fast switching between HDMI input ports
+ *
+ * In fast switch mode, the HAL keeps HPD asserted, the TMDS/FRL link locked and HDCP authenticated in the background
+ * on up to @a maxPorts connected, non-selected ports, so that dsHdmiInSelectPort() of such a port does not have to
+ * re-establish the link. Ports are chosen in most recently selected order. Disabling fast switch releases the links
+ * of all non-selected ports.
+ *
+ * For sink devices, this function sets the fast switch mode.
+ * For source devices, this function returns dsERR_OPERATION_NOT_SUPPORTED always.
+ *
+ * @param[in] enable    - Fast switch mode ( @a true to enable, @a false to disable)
+ * @param[in] maxPorts  - Maximum number of non-selected ports kept ready, from 1 to dsHDMI_IN_PORT_MAX - 1.
+ *                          Ignored when @a enable is false
+ *
+ * @return dsError_t                        - Status
+ * @retval dsERR_NONE                       - Success
+ * @retval dsERR_NOT_INITIALIZED            - Module is not initialised
+ * @retval dsERR_INVALID_PARAM              - Parameter passed to this function is invalid
+ * @retval dsERR_OPERATION_NOT_SUPPORTED    - The attempted operation is not supported; e.g: source devices, or the SoC
+ *                                              cannot maintain more than one link
+ * @retval dsERR_OPERATION_FAILED           - The attempted operation has failed
+ *
+ * @pre dsHdmiInInit() must be called before calling this API.
+ *
+ * @warning  This API is Not thread safe.
+ *
+ * @see dsHdmiInGetPortReadiness()
+ */
+dsError_t dsHdmiInSetFastSwitch (bool enable, uint32_t maxPorts);
+
+/**
+ * @brief Gets the fast switch readiness of an HDMI input port
+ *
+ * For sink devices, this function gets whether the specified port is kept ready for fast switching, and the latency
+ * of its last selection.
+ * For source devices, this function returns dsERR_OPERATION_NOT_SUPPORTED always.
+ *
+ * @param[in]  Port         - HDMI input port.  Please refer ::dsHdmiInPort_t
+ * @param[out] readiness    - Port readiness.  Please refer ::dsHdmiInPortReadiness_t
+ *
+ * @return dsError_t                        - Status
+ * @retval dsERR_NONE                       - Success
+ * @retval dsERR_NOT_INITIALIZED            - Module is not initialised
+ * @retval dsERR_INVALID_PARAM              - Parameter passed to this function is invalid
+ * @retval dsERR_OPERATION_NOT_SUPPORTED    - The attempted operation is not supported; e.g: source devices
+ * @retval dsERR_OPERATION_FAILED           - The attempted operation has failed
+ *
+ * @pre dsHdmiInInit() must be called before calling this API.
+ *
+ * @warning  This API is Not thread safe.
+ *
+ * @see dsHdmiInSetFastSwitch()
+ */
+dsError_t dsHdmiInGetPortReadiness (dsHdmiInPort_t Port, dsHdmiInPortReadiness_t *readiness);
+
 /**
  * @brief Scales the HDMI input video
  *
@@ -606,6 +696,59 @@ dsError_t dsIsHdmiARCPort (dsHdmiInPort_t iPort, bool *isArcPort);
  */
 dsError_t dsGetEDIDBytesInfo (dsHdmiInPort_t iHdmiPort, unsigned char *edid, int *length);
 
+/**
+ * @brief Acquires a read-only view of the EDID exposed on the given HDMI input port.
+ *
+ * This function returns a pointer to the EDID block held by the HAL instead of copying it.
+ * Each successful call takes a reference on the block that must be dropped with dsHdmiInReleaseEDIDView().
+ * The block is kept alive while referenced, so a view stays valid across EDID changes; the
+ * generation in the view tells the caller whether it still matches the current EDID.
+ * The generation is incremented whenever the EDID of the port changes, e.g. after dsSetEdidVersion(), and by dsHdmiInInit().
+ * It never goes backwards: it is not reset by dsHdmiInTerm() and dsHdmiInInit() within the life of the process,
+ * and a re-initialisation counts as a change of the EDID.
+ *
+ * @param[in]  iHdmiPort   - HDMI input port.  Please refer ::dsHdmiInPort_t
+ * @param[out] view         - View to be filled.  Please refer ::dsEDIDView_t
+ *
+ * @return dsError_t                        - Status
+ * @retval dsERR_NONE                       - Success
+ * @retval dsERR_NOT_INITIALIZED            - Module is not initialised
+ * @retval dsERR_INVALID_PARAM              - Parameter passed to this function is invalid
+ * @retval dsERR_OPERATION_NOT_SUPPORTED    - The attempted operation is not supported; e.g: source devices
+ * @retval dsERR_GENERAL                    - Underlying undefined platform error
+ *
+ * @pre dsHdmiInInit() must be called before calling this API.
+ * @post dsHdmiInReleaseEDIDView() must be called to release the view.
+ *
+ * @warning  This API is Not thread safe.
+ *
+ * @see dsHdmiInReleaseEDIDView(), dsGetEDIDBytesInfo()
+ */
+dsError_t dsHdmiInAcquireEDIDView(dsHdmiInPort_t iHdmiPort, dsEDIDView_t *view);
+
+/**
+ * @brief Releases a view acquired with dsHdmiInAcquireEDIDView().
+ *
+ * On return, view->data is set to NULL and must not be dereferenced.
+ * All views must be released before the module is terminated.
+ *
+ * @param[in]  iHdmiPort   - HDMI input port.  Please refer ::dsHdmiInPort_t
+ * @param[in,out] view     - View returned by dsHdmiInAcquireEDIDView().  Please refer ::dsEDIDView_t
+ *
+ * @return dsError_t                        - Status
+ * @retval dsERR_NONE                       - Success
+ * @retval dsERR_NOT_INITIALIZED            - Module is not initialised
+ * @retval dsERR_INVALID_PARAM              - Parameter passed to this function is invalid, or view was not acquired
+ * @retval dsERR_GENERAL                    - Underlying undefined platform error
+ *
+ * @pre dsHdmiInAcquireEDIDView() must be called before calling this API.
+ *
+ * @warning  This API is Not thread safe.
+ *
+ * @see dsHdmiInAcquireEDIDView()
+ */
+dsError_t dsHdmiInReleaseEDIDView(dsHdmiInPort_t iHdmiPort, dsEDIDView_t *view);
+
 /**
  * @brief Gets the HDMI SPD info
  * 
@@ -630,6 +773,74 @@ dsError_t dsGetEDIDBytesInfo (dsHdmiInPort_t iHdmiPort, unsigned char *edid, int
  */
 dsError_t dsGetHDMISPDInfo (dsHdmiInPort_t iHdmiPort, unsigned char *data);
 
+/**
+ * @brief Gets the parsed InfoFrames of an HDMI input port
+ *
+ * The HAL parses the SPD, AVI and Dynamic Range and Mastering InfoFrames of every connected port when they change,
+ * and keeps the result until the source disconnects. This function is served from that cache and must not read
+ * from the receiver, so it may be called on every UI query.
+ *
+ * For sink devices, this function gets the cached InfoFrames of the specified HDMI input port.
+ * For source devices, this function returns dsERR_OPERATION_NOT_SUPPORTED always.
+ *
+ * @param[in]  iHdmiPort    - HDMI input port.  Please refer ::dsHdmiInPort_t
+ * @param[out] frames       - Parsed InfoFrames.  Please refer ::dsHdmiInInfoFrames_t
+ *
+ * @return dsError_t                        - Status
+ * @retval dsERR_NONE                       - Success
+ * @retval dsERR_NOT_INITIALIZED            - Module is not initialised
+ * @retval dsERR_INVALID_PARAM              - Parameter passed to this function is invalid
+ * @retval dsERR_OPERATION_NOT_SUPPORTED    - The attempted operation is not supported; e.g: source devices
+ * @retval dsERR_OPERATION_FAILED           - The attempted operation has failed
+ *
+ * @pre dsHdmiInInit() must be called before calling this API
+ *
+ * @warning  This API is Not thread safe.
+ *
+ * @see dsHdmiInRegisterInfoFrameChangeCB(), dsGetHDMISPDInfo()
+ */
+dsError_t dsHdmiInGetInfoFrames (dsHdmiInPort_t iHdmiPort, dsHdmiInInfoFrames_t *frames);
+
+/**
+ * @brief Notifies applications of a change of the InfoFrames of an HDMI input port
+ *
+ * HAL Implementation should call this method when the content of a cached InfoFrame changes, when it is first
+ * received and when it is cleared on disconnection. Retransmissions of an identical InfoFrame are not notified.
+ *
+ * @param[in] port          - HDMI input port.  Please refer ::dsHdmiInPort_t
+ * @param[in] changedMask   - Bitwise OR of the ::dsHdmiInInfoFrameType_t values that changed
+ * @param[in] frames        - New InfoFrames of the port.  Please refer ::dsHdmiInInfoFrames_t
+ *                              Only valid for the duration of the callback
+ *
+ * @pre dsHdmiInRegisterInfoFrameChangeCB() must be called before this API
+ */
+typedef void (*dsHdmiInInfoFrameChangeCB_t)(dsHdmiInPort_t port, uint32_t changedMask, const dsHdmiInInfoFrames_t *frames);
+
+/**
+ * @brief Registers the HDMI Input InfoFrame change event
+ *
+ * For sink devices, this function registers for the HDMI Input InfoFrame change event.
+ * For source devices, this function returns dsERR_OPERATION_NOT_SUPPORTED always.
+ *
+ * @param[in] CBFunc    - HDMI input InfoFrame change callback function.
+ *                               Please refer ::dsHdmiInInfoFrameChangeCB_t
+ *
+ * @return dsError_t                        - Status
+ * @retval dsERR_NONE                       - Success
+ * @retval dsERR_NOT_INITIALIZED            - Module is not initialised
+ * @retval dsERR_INVALID_PARAM              - Parameter passed to this function is invalid
+ * @retval dsERR_OPERATION_NOT_SUPPORTED    - The attempted operation is not supported; e.g: source devices
+ * @retval dsERR_GENERAL                    - Underlying undefined platform error
+ *
+ * @pre dsHdmiInInit() must be called before calling this API
+ *
+ * @see dsHdmiInInfoFrameChangeCB_t, dsHdmiInGetInfoFrames()
+ *
+ * @warning  This API is Not thread safe.
+ *
+ */
+dsError_t dsHdmiInRegisterInfoFrameChangeCB (dsHdmiInInfoFrameChangeCB_t CBFunc);
+
 /**
  * @brief Sets the EDID version to be used for a given port id
  * 
@@ -908,6 +1119,222 @@ dsError_t dsHdmiInRegisterVRRChangeCB(dsHdmiInVRRChangeCB_t cb);
 */
 dsError_t dsHdmiInGetVRRStatus(dsHdmiInPort_t port, dsHdmiInVrrStatus_t *vrrStatus);
 
+/**
+* @brief Gets the VRR refresh rate histogram of the specified HDMI input port.
+*
+* While VRR is active on a port, the HAL counts the refresh rate of every incoming frame into a histogram kept per port.
+* Counters must be updated without locks from the frame notification context, so collection does not need a polling
+* thread. Counters accumulate until dsHdmiInResetVRRHistogram() is called or the source disconnects. The returned
+* values may be read while frames are being counted, so the sum of the bins may differ slightly from sampleCount.
+*
+* For sink devices, this function gets the VRR refresh rate histogram of the specified HDMI input port.
+* For source devices, this function returns dsERR_OPERATION_NOT_SUPPORTED always.
+*
+* @param[in]  port       - HDMI input port. Please refer ::dsHdmiInPort_t
+* @param[out] histogram  - VRR refresh rate histogram. Please refer ::dsHdmiInVrrHistogram_t
+*
+* @return dsError_t                        - Status
+* @retval dsERR_NONE                       - Success
+* @retval dsERR_NOT_INITIALIZED            - Module is not initialized
+* @retval dsERR_INVALID_PARAM              - Parameter passed to this function is invalid
+* @retval dsERR_OPERATION_NOT_SUPPORTED    - The attempted operation is not supported; e.g: source devices
+*
+* @pre dsHdmiInInit() must be called before calling this API
+*
+* @warning This API is Not thread safe
+*
+* @see dsHdmiInResetVRRHistogram(), dsHdmiInGetVRRStatus()
+*/
+dsError_t dsHdmiInGetVRRHistogram(dsHdmiInPort_t port, dsHdmiInVrrHistogram_t *histogram);
+
+/**
+* @brief Clears the VRR refresh rate histogram of the specified HDMI input port.
+*
+* For sink devices, this function clears all counters of the VRR refresh rate histogram of the specified HDMI input port
+* and restarts collection.
+* For source devices, this function returns dsERR_OPERATION_NOT_SUPPORTED always.
+*
+* @param[in] port       - HDMI input port. Please refer ::dsHdmiInPort_t
+*
+* @return dsError_t                        - Status
+* @retval dsERR_NONE                       - Success
+* @retval dsERR_NOT_INITIALIZED            - Module is not initialized
+* @retval dsERR_INVALID_PARAM              - Parameter passed to this function is invalid
+* @retval dsERR_OPERATION_NOT_SUPPORTED    - The attempted operation is not supported; e.g: source devices
+*
+* @pre dsHdmiInInit() must be called before calling this API
+*
+* @warning This API is Not thread safe
+*
+* @see dsHdmiInGetVRRHistogram()
+*/
+dsError_t dsHdmiInResetVRRHistogram(dsHdmiInPort_t port);
+
+/**
+ * @brief Notifies applications of the completion of a game mode transition
+ *
+ * HAL Implementation should call this method once for every successful dsHdmiInApplyGameModeProfile() call:
+ * when the port presents video again, or when ::dsHDMI_IN_GAME_MODE_TIMEOUT_MS has elapsed without it doing so.
+ * For a port that is not the active port, it is called once the settings are committed.
+ *
+ * @param[in] port      - HDMI input port.  Please refer ::dsHdmiInPort_t
+ * @param[in] status    - dsERR_NONE if the transition completed, dsERR_OPERATION_FAILED if the port did not present
+ *                          video within ::dsHDMI_IN_GAME_MODE_TIMEOUT_MS. The settings remain applied in both cases
+ * @param[in] result    - Transition result.  Please refer ::dsHdmiInGameModeResult_t
+ *                          Only valid for the duration of the callback. All values are 0 if status is not dsERR_NONE
+ *
+ * @pre dsHdmiInRegisterGameModeCompleteCB() must be called before this API
+ */
+typedef void (*dsHdmiInGameModeCompleteCB_t)(dsHdmiInPort_t port, dsError_t status, const dsHdmiInGameModeResult_t *result);
+
+/**
+ * @brief Registers the HDMI Input game mode transition complete event
+ *
+ * For sink devices, this function registers for the game mode transition complete event.
+ * For source devices, this function returns dsERR_OPERATION_NOT_SUPPORTED always.
+ *
+ * @param[in] CBFunc    - Game mode transition complete callback function.
+ *                               Please refer ::dsHdmiInGameModeCompleteCB_t
+ *
+ * @return dsError_t                        - Status
+ * @retval dsERR_NONE                       - Success
+ * @retval dsERR_NOT_INITIALIZED            - Module is not initialised
+ * @retval dsERR_INVALID_PARAM              - Parameter passed to this function is invalid
+ * @retval dsERR_OPERATION_NOT_SUPPORTED    - The attempted operation is not supported; e.g: source devices
+ * @retval dsERR_GENERAL                    - Underlying undefined platform error
+ *
+ * @pre dsHdmiInInit() must be called before calling this API
+ *
+ * @see dsHdmiInGameModeCompleteCB_t, dsHdmiInApplyGameModeProfile()
+ *
+ * @warning  This API is Not thread safe.
+ *
+ */
+dsError_t dsHdmiInRegisterGameModeCompleteCB (dsHdmiInGameModeCompleteCB_t CBFunc);
+
+/**
+ * @brief Applies a low latency game mode profile to an HDMI input port in one transition
+ *
+ * For sink devices, this function validates every setting selected in profile->applyMask before changing anything,
+ * then commits all of them with at most one re-synchronisation of the port, giving the same end state as calling
+ * dsSetEdid2AllmSupport(), dsHdmiInSetVRRSupport(), dsHdmiInSelectZoomMode(), dsHdmiInScaleVideo() and dsSetAudioDelay()
+ * individually. Either all selected settings are applied, or none are and the previous configuration remains in effect.
+ * The function returns as soon as the settings are committed and does not wait for the port to re-synchronise;
+ * the duration of the transition and the resulting AV latency are reported through ::dsHdmiInGameModeCompleteCB_t.
+ * It may therefore be called from ::dsHdmiInAllmChangeCB_t or ::dsHdmiInAviContentTypeChangeCB_t
+ * (with dsAVICONTENT_TYPE_GAME).
+ *
+ * Zoom mode, video scaling and audio delay are global and apply to the presentation of the active port.
+ * When @a iHdmiPort is not the active port, only the EDID settings (dsHDMI_IN_GAME_MODE_ALLM_SUPPORT and
+ * dsHDMI_IN_GAME_MODE_VRR_SUPPORT) may be selected; selecting any other setting returns dsERR_INVALID_PARAM
+ * and nothing is applied.
+ * For source devices, this function returns dsERR_OPERATION_NOT_SUPPORTED always.
+ *
+ * @param[in]  iHdmiPort    - HDMI input port.  Please refer ::dsHdmiInPort_t
+ * @param[in]  profile      - Settings to apply.  Please refer ::dsHdmiInGameModeProfile_t
+ *
+ * @return dsError_t                        - Status
+ * @retval dsERR_NONE                       - Success; all selected settings are committed and completion will be notified
+ * @retval dsERR_NOT_INITIALIZED            - Module is not initialised
+ * @retval dsERR_INVALID_PARAM              - Parameter passed to this function is invalid, size is smaller than
+ *                                              offsetof(dsHdmiInGameModeProfile_t, allmSupport), applyMask selects a setting whose
+ *                                              fields lie beyond size, applyMask selects a global setting and iHdmiPort is
+ *                                              not the active port, or any selected value is out of range.
+ *                                              Nothing is applied.
+ * @retval dsERR_OPERATION_NOT_SUPPORTED    - The attempted operation is not supported; e.g: source devices, or any selected
+ *                                              setting is not supported. Nothing is applied.
+ * @retval dsERR_OPERATION_FAILED           - The attempted operation has failed. The previous configuration remains in effect.
+ *
+ * @pre dsHdmiInInit() must be called before calling this API. dsAudioPortInit() and dsGetAudioPort() must be called
+ *      before selecting dsHDMI_IN_GAME_MODE_AUDIO_DELAY.
+ *
+ * @warning  This API is Not thread safe.
+ *
+ * @see dsHdmiInRegisterGameModeCompleteCB(), dsGetAVLatency(), dsHdmiInGetAVLatencyStats()
+ */
+dsError_t dsHdmiInApplyGameModeProfile(dsHdmiInPort_t iHdmiPort, const dsHdmiInGameModeProfile_t *profile);
+
+/**
+ * @brief Gets the AV latency statistics of an HDMI input port
+ *
+ * While a port is the active port, the HAL samples its AV latency every ::dsHDMI_IN_AV_LATENCY_SAMPLE_INTERVAL_MS
+ * into a ring of the last ::dsHDMI_IN_AV_LATENCY_HISTORY_LEN samples, kept per port. This function summarises
+ * the samples currently in the ring of the port, so the caller does not need to poll dsGetAVLatency().
+ * Percentiles are nearest-rank values over the samples.
+ *
+ * For sink devices, this function gets the AV latency statistics of the specified HDMI input port.
+ * For source devices, this function returns dsERR_OPERATION_NOT_SUPPORTED always.
+ *
+ * @param[in]  iHdmiPort    - HDMI input port.  Please refer ::dsHdmiInPort_t
+ * @param[out] stats        - AV latency statistics.  Please refer ::dsHdmiInAVLatencyStats_t
+ *                              All summary values are 0 if sampleCount is 0
+ *
+ * @return dsError_t                        - Status
+ * @retval dsERR_NONE                       - Success
+ * @retval dsERR_NOT_INITIALIZED            - Module is not initialised
+ * @retval dsERR_INVALID_PARAM              - Parameter passed to this function is invalid
+ * @retval dsERR_OPERATION_NOT_SUPPORTED    - The attempted operation is not supported; e.g: source devices
+ * @retval dsERR_OPERATION_FAILED           - The attempted operation has failed
+ *
+ * @pre dsHdmiInInit() must be called before calling this API
+ *
+ * @warning  This API is Not thread safe
+ *
+ * @see dsHdmiInGetAVLatencyHistory(), dsHdmiInResetAVLatencyHistory()
+ */
+dsError_t dsHdmiInGetAVLatencyStats(dsHdmiInPort_t iHdmiPort, dsHdmiInAVLatencyStats_t *stats);
+
+/**
+ * @brief Gets the AV latency samples of an HDMI input port
+ *
+ * For sink devices, this function copies the samples currently in the AV latency ring of the specified
+ * HDMI input port, oldest first.
+ * For source devices, this function returns dsERR_OPERATION_NOT_SUPPORTED always.
+ *
+ * @param[in]  iHdmiPort    - HDMI input port.  Please refer ::dsHdmiInPort_t
+ * @param[out] samples      - Caller-allocated array of at least @a maxSamples samples.  Please refer ::dsHdmiInAVLatencySample_t
+ * @param[in]  maxSamples   - Capacity of @a samples. When smaller than the number of samples in the ring, the newest are returned
+ * @param[out] count        - Number of samples copied into @a samples
+ *
+ * @return dsError_t                        - Status
+ * @retval dsERR_NONE                       - Success
+ * @retval dsERR_NOT_INITIALIZED            - Module is not initialised
+ * @retval dsERR_INVALID_PARAM              - Parameter passed to this function is invalid
+ * @retval dsERR_OPERATION_NOT_SUPPORTED    - The attempted operation is not supported; e.g: source devices
+ * @retval dsERR_OPERATION_FAILED           - The attempted operation has failed
+ *
+ * @pre dsHdmiInInit() must be called before calling this API
+ *
+ * @warning  This API is Not thread safe
+ *
+ * @see dsHdmiInGetAVLatencyStats()
+ */
+dsError_t dsHdmiInGetAVLatencyHistory(dsHdmiInPort_t iHdmiPort, dsHdmiInAVLatencySample_t *samples, uint32_t maxSamples, uint32_t *count);
+
+/**
+ * @brief Clears the AV latency samples of an HDMI input port
+ *
+ * For sink devices, this function empties the AV latency ring of the specified HDMI input port,
+ * e.g. before measuring a new game mode setting.
+ * For source devices, this function returns dsERR_OPERATION_NOT_SUPPORTED always.
+ *
+ * @param[in] iHdmiPort     - HDMI input port.  Please refer ::dsHdmiInPort_t
+ *
+ * @return dsError_t                        - Status
+ * @retval dsERR_NONE                       - Success
+ * @retval dsERR_NOT_INITIALIZED            - Module is not initialised
+ * @retval dsERR_INVALID_PARAM              - Parameter passed to this function is invalid
+ * @retval dsERR_OPERATION_NOT_SUPPORTED    - The attempted operation is not supported; e.g: source devices
+ * @retval dsERR_OPERATION_FAILED           - The attempted operation has failed
+ *
+ * @pre dsHdmiInInit() must be called before calling this API
+ *
+ * @warning  This API is Not thread safe
+ *
+ * @see dsHdmiInGetAVLatencyStats()
+ */
+dsError_t dsHdmiInResetAVLatencyHistory(dsHdmiInPort_t iHdmiPort);
+
 #ifdef __cplusplus
 }
 #endif
@@ -90,6 +90,9 @@
 #define __DS_HDMI_IN_TYPES_H__
 
 #include <stdint.h>
+#include <stdbool.h>
+#include "dsAVDTypes.h"
+#include "dsVideoDeviceTypes.h"
 
 #pragma once //Required for compilation, until header structure is properly updated.
 
@@ -221,6 +224,250 @@ typedef struct _dsHdmiInVrrStatus_t
     double  vrrAmdfreesyncFramerate_Hz;  /*! Display VRR FrameRate in Hz */
 } dsHdmiInVrrStatus_t;
 
+/**
+ * @brief Number of AV latency samples kept per HDMI input port.
+ * @see dsHdmiInGetAVLatencyHistory()
+ */
+#define dsHDMI_IN_AV_LATENCY_HISTORY_LEN 128
+
+/**
+ * @brief Interval, in milliseconds, at which AV latency samples are taken.
+ */
+#define dsHDMI_IN_AV_LATENCY_SAMPLE_INTERVAL_MS 100
+
+/**
+ * @brief Structure type for one AV latency sample.
+ */
+typedef struct _dsHdmiInAVLatencySample_t
+{
+    uint64_t timestampNs;   /*!< CLOCK_MONOTONIC time of the sample, in nanoseconds */
+    int32_t  audioLatency;  /*!< Audio latency in ms. Max value 500ms. Min value 0 */
+    int32_t  videoLatency;  /*!< Video latency in ms. Max value 500ms. Min value 0 */
+} dsHdmiInAVLatencySample_t;
+
+/**
+ * @brief Structure type for the summary of one latency over the samples in the history.
+ */
+typedef struct _dsHdmiInLatencySummary_t
+{
+    int32_t min;    /*!< Minimum latency in ms */
+    int32_t max;    /*!< Maximum latency in ms */
+    int32_t mean;   /*!< Mean latency in ms, rounded down */
+    int32_t p50;    /*!< 50th percentile latency in ms */
+    int32_t p95;    /*!< 95th percentile latency in ms */
+    int32_t p99;    /*!< 99th percentile latency in ms */
+} dsHdmiInLatencySummary_t;
+
+/**
+ * @brief Structure type for the AV latency statistics of an HDMI input port.
+ */
+typedef struct _dsHdmiInAVLatencyStats_t
+{
+    uint32_t sampleCount;               /*!< Number of samples summarised, up to ::dsHDMI_IN_AV_LATENCY_HISTORY_LEN. 0 if none */
+    uint64_t firstTimestampNs;          /*!< CLOCK_MONOTONIC time of the oldest sample summarised, in nanoseconds */
+    uint64_t lastTimestampNs;           /*!< CLOCK_MONOTONIC time of the newest sample summarised, in nanoseconds */
+    dsHdmiInLatencySummary_t audio;     /*!< Audio latency summary. Please refer ::dsHdmiInLatencySummary_t */
+    dsHdmiInLatencySummary_t video;     /*!< Video latency summary. Please refer ::dsHdmiInLatencySummary_t */
+} dsHdmiInAVLatencyStats_t;
+
+/**
+ * @brief Structure type for the fast switch readiness of an HDMI input port.
+ */
+typedef struct _dsHdmiInPortReadiness_t
+{
+    bool     prewarmed;                 /*!< @a true if the HAL is maintaining the link of this non-selected port in the background */
+    bool     linkLocked;                /*!< @a true if the TMDS/FRL link of the port is locked */
+    bool     hdcpAuthenticated;         /*!< @a true if HDCP authentication of the port has completed */
+    uint32_t lastSelectToFrameMs;       /*!< Time, in milliseconds, from the last dsHdmiInSelectPort() of this port to its first presented frame. 0 if not measured */
+} dsHdmiInPortReadiness_t;
+
+/**
+ * @brief Bit of an HDMI input port in a port mask.
+ * @see dsHdmiInStatusDelta_t
+ */
+#define dsHDMI_IN_PORT_MASK(port)  (((uint32_t)1) << (port))
+
+/**
+ * @brief Structure type for the state of one HDMI input port.
+ */
+typedef struct _dsHdmiInPortState_t
+{
+    bool                    isPortConnected;    /*!< Boolean flag indicating HDMI source connected to this HDMI input port */
+    dsHdmiInSignalStatus_t  sigStatus;          /*!< Signal status.  Please refer ::dsHdmiInSignalStatus_t */
+    dsVideoPortResolution_t videoMode;          /*!< Incoming video mode.  Please refer ::dsVideoPortResolution_t */
+} dsHdmiInPortState_t;
+
+/**
+ * @brief Structure type for the changes of HDMI input status since a given generation.
+ */
+typedef struct _dsHdmiInStatusDelta_t
+{
+    uint32_t            generation;                     /*!< Current status generation, to be passed to the next dsHdmiInGetStatusDelta() call */
+    uint32_t            changedPortMask;                /*!< dsHDMI_IN_PORT_MASK() bits of the ports whose state changed since the requested generation */
+    bool                isPresented;                    /*!< As ::dsHdmiInStatus_t */
+    dsHdmiInPort_t      activePort;                     /*!< As ::dsHdmiInStatus_t */
+    dsHdmiInPortState_t ports[dsHDMI_IN_PORT_MAX];      /*!< New state of each port. Only entries whose bit is set in changedPortMask are filled */
+} dsHdmiInStatusDelta_t;
+
+/**
+ * @brief Enumeration of the InfoFrames cached per HDMI input port.
+ * Each bit of uint32_t represents one InfoFrame; masks are the bitwise OR of the InfoFrames concerned.
+ */
+typedef enum _dsHdmiInInfoFrameType_t
+{
+    dsHDMI_IN_INFOFRAME_SPD = 0x1,  /*!< Source Product Description InfoFrame */
+    dsHDMI_IN_INFOFRAME_AVI = 0x2,  /*!< Auxiliary Video Information InfoFrame */
+    dsHDMI_IN_INFOFRAME_HDR = 0x4,  /*!< Dynamic Range and Mastering (HDR static metadata) InfoFrame */
+    dsHDMI_IN_INFOFRAME_ALL = 0x7   /*!< All InfoFrames */
+} dsHdmiInInfoFrameType_t;
+
+/**
+ * @brief Maximum length of the SPD vendor name: the 8 byte CTA-861 SPD field plus the terminating NUL.
+ */
+#define dsHDMI_IN_SPD_VENDOR_NAME_LEN 9
+
+/**
+ * @brief Maximum length of the SPD product description: the 16 byte CTA-861 SPD field plus the terminating NUL.
+ */
+#define dsHDMI_IN_SPD_PRODUCT_DESC_LEN 17
+
+/**
+ * @brief Structure type for a parsed SPD InfoFrame.
+ */
+typedef struct _dsHdmiInSpdInfo_t
+{
+    bool    valid;                                              /*!< @a true if an SPD InfoFrame has been received since the source connected */
+    char    vendorName[dsHDMI_IN_SPD_VENDOR_NAME_LEN];          /*!< Vendor name, NUL terminated with trailing spaces and NULs removed */
+    char    productDescription[dsHDMI_IN_SPD_PRODUCT_DESC_LEN]; /*!< Product description, NUL terminated with trailing spaces and NULs removed */
+    uint8_t sourceInfo;                                         /*!< Source device information code, as defined by CTA-861 */
+} dsHdmiInSpdInfo_t;
+
+/**
+ * @brief Structure type for a parsed AVI InfoFrame.
+ */
+typedef struct _dsHdmiInAviInfo_t
+{
+    bool                            valid;              /*!< @a true if an AVI InfoFrame has been received since the source connected */
+    dsDisplayColorSpace_t           colorSpace;         /*!< Color space.  Please refer ::dsDisplayColorSpace_t */
+    dsDisplayMatrixCoefficients_t   colorimetry;        /*!< Colorimetry.  Please refer ::dsDisplayMatrixCoefficients_t */
+    dsDisplayQuantizationRange_t    quantizationRange;  /*!< Quantization range.  Please refer ::dsDisplayQuantizationRange_t */
+    dsVideoAspectRatio_t            aspectRatio;        /*!< Picture aspect ratio.  Please refer ::dsVideoAspectRatio_t */
+    dsAviContentType_t              contentType;        /*!< Content type.  Please refer ::dsAviContentType_t */
+    uint8_t                         vic;                /*!< Video Identification Code. 0 if not signalled */
+} dsHdmiInAviInfo_t;
+
+/**
+ * @brief Structure type for a parsed Dynamic Range and Mastering InfoFrame.
+ * Chromaticity coordinates are in units of 0.00002, luminance values in cd/m2 unless stated otherwise.
+ */
+typedef struct _dsHdmiInHdrInfo_t
+{
+    bool            valid;                  /*!< @a true if a Dynamic Range and Mastering InfoFrame is being received */
+    dsHDRStandard_t eotf;                   /*!< EOTF.  Please refer ::dsHDRStandard_t */
+    uint16_t        primaryX[3];            /*!< Display primaries x coordinates */
+    uint16_t        primaryY[3];            /*!< Display primaries y coordinates */
+    uint16_t        whitePointX;            /*!< White point x coordinate */
+    uint16_t        whitePointY;            /*!< White point y coordinate */
+    uint16_t        maxDisplayLuminance;    /*!< Maximum display mastering luminance */
+    uint16_t        minDisplayLuminance;    /*!< Minimum display mastering luminance, in units of 0.0001 cd/m2 */
+    uint16_t        maxCLL;                 /*!< Maximum content light level */
+    uint16_t        maxFALL;                /*!< Maximum frame-average light level */
+} dsHdmiInHdrInfo_t;
+
+/**
+ * @brief Structure type for the cached InfoFrames of an HDMI input port.
+ */
+typedef struct _dsHdmiInInfoFrames_t
+{
+    uint32_t            generation;     /*!< Incremented whenever any InfoFrame of the port changes */
+    dsHdmiInSpdInfo_t   spd;            /*!< SPD InfoFrame.  Please refer ::dsHdmiInSpdInfo_t */
+    dsHdmiInAviInfo_t   avi;            /*!< AVI InfoFrame.  Please refer ::dsHdmiInAviInfo_t */
+    dsHdmiInHdrInfo_t   hdr;            /*!< Dynamic Range and Mastering InfoFrame.  Please refer ::dsHdmiInHdrInfo_t */
+} dsHdmiInInfoFrames_t;
+
+/**
+ * @brief Number of bins of the VRR refresh rate histogram.
+ * @see dsHdmiInGetVRRHistogram()
+ */
+#define dsHDMI_IN_VRR_HISTOGRAM_BINS 16
+
+/**
+ * @brief Structure type for the VRR refresh rate histogram of an HDMI input port.
+ * The bins divide the VRR range of the sink equally; bin i counts the frames whose refresh rate was in
+ * [binStart_Hz + i * binWidth_Hz, binStart_Hz + (i + 1) * binWidth_Hz). Frames below or above the range
+ * are counted in the first or last bin.
+ */
+typedef struct _dsHdmiInVrrHistogram_t
+{
+    uint64_t startTimestampNs;                          /*!< CLOCK_MONOTONIC time, in nanoseconds, at which collection started */
+    uint32_t sampleCount;                               /*!< Number of frames received while VRR was active */
+    double   binStart_Hz;                               /*!< Lower edge of the first bin in Hz */
+    double   binWidth_Hz;                               /*!< Width of each bin in Hz */
+    uint32_t bins[dsHDMI_IN_VRR_HISTOGRAM_BINS];        /*!< Frame count of each bin */
+    double   minFramerate_Hz;                           /*!< Lowest refresh rate received in Hz. 0 if sampleCount is 0 */
+    double   maxFramerate_Hz;                           /*!< Highest refresh rate received in Hz. 0 if sampleCount is 0 */
+    uint32_t lfcFrameCount;                             /*!< Number of frames repeated by Low Framerate Compensation */
+    uint32_t lfcActivations;                            /*!< Number of times Low Framerate Compensation became active */
+} dsHdmiInVrrHistogram_t;
+
+/**
+ * @brief Enumeration of the settings of a game mode profile.
+ * Each bit of uint32_t represents one setting; masks are the bitwise OR of the settings concerned.
+ * New settings are only ever appended, existing values never change.
+ */
+typedef enum _dsHdmiInGameModeField_t
+{
+    dsHDMI_IN_GAME_MODE_ALLM_SUPPORT = 0x01,    /*!< dsHdmiInGameModeProfile_t::allmSupport, as dsSetEdid2AllmSupport() */
+    dsHDMI_IN_GAME_MODE_VRR_SUPPORT  = 0x02,    /*!< dsHdmiInGameModeProfile_t::vrrSupport, as dsHdmiInSetVRRSupport() */
+    dsHDMI_IN_GAME_MODE_ZOOM_MODE    = 0x04,    /*!< dsHdmiInGameModeProfile_t::zoomMode, as dsHdmiInSelectZoomMode() */
+    dsHDMI_IN_GAME_MODE_VIDEO_SCALE  = 0x08,    /*!< dsHdmiInGameModeProfile_t::x, y, width and height, as dsHdmiInScaleVideo() */
+    dsHDMI_IN_GAME_MODE_AUDIO_DELAY  = 0x10,    /*!< dsHdmiInGameModeProfile_t::audioDelayMs, as dsSetAudioDelay() on audioPortHandle */
+    dsHDMI_IN_GAME_MODE_ALL          = 0x1F     /*!< All settings */
+} dsHdmiInGameModeField_t;
+
+/**
+ * @brief Structure type for a low latency game mode profile applied by dsHdmiInApplyGameModeProfile().
+ * The caller sets @c size to its compiled sizeof(dsHdmiInGameModeProfile_t) and @c applyMask to the bitwise OR
+ * of the ::dsHdmiInGameModeField_t settings to change; fields whose bit is not set are ignored.
+ * Fields are only ever appended; the implementation must not read beyond @c size bytes.
+ * A setting selected in @c applyMask whose fields lie wholly or partly beyond @c size is rejected with
+ * dsERR_INVALID_PARAM and nothing is applied; it is never silently skipped.
+ * Value ranges for each field are as documented on the corresponding setter.
+ */
+typedef struct _dsHdmiInGameModeProfile_t
+{
+    uint32_t        size;               /*!< [in] sizeof(dsHdmiInGameModeProfile_t) as compiled by the caller */
+    uint32_t        applyMask;          /*!< [in] Bitwise OR of settings to apply.  Please refer ::dsHdmiInGameModeField_t */
+    bool            allmSupport;        /*!< [in] EDID ALLM support, as dsSetEdid2AllmSupport() */
+    bool            vrrSupport;         /*!< [in] EDID VRR support, as dsHdmiInSetVRRSupport() */
+    dsVideoZoom_t   zoomMode;           /*!< [in] Zoom mode, as dsHdmiInSelectZoomMode().  Please refer ::dsVideoZoom_t */
+    int32_t         x;                  /*!< [in] x coordinate of the video, as dsHdmiInScaleVideo() */
+    int32_t         y;                  /*!< [in] y coordinate of the video, as dsHdmiInScaleVideo() */
+    int32_t         width;              /*!< [in] Width of the video, as dsHdmiInScaleVideo() */
+    int32_t         height;             /*!< [in] Height of the video, as dsHdmiInScaleVideo() */
+    intptr_t        audioPortHandle;    /*!< [in] Handle of the audio output port returned from dsGetAudioPort() */
+    uint32_t        audioDelayMs;       /*!< [in] Audio delay in milliseconds, as dsSetAudioDelay() */
+} dsHdmiInGameModeProfile_t;
+
+/**
+ * @brief Time, in milliseconds, within which a port must present video again after dsHdmiInApplyGameModeProfile().
+ * @see dsHdmiInGameModeCompleteCB_t
+ */
+#define dsHDMI_IN_GAME_MODE_TIMEOUT_MS 5000
+
+/**
+ * @brief Structure type for the result of dsHdmiInApplyGameModeProfile(), reported through ::dsHdmiInGameModeCompleteCB_t.
+ */
+typedef struct _dsHdmiInGameModeResult_t
+{
+    uint32_t transitionMs;      /*!< Time, in milliseconds, from the start of the transition until the port presented video again.
+                                     0 if the port is not the active port */
+    int32_t  audioLatency;      /*!< Audio latency in ms after the transition, as dsGetAVLatency(). Max value 500ms. Min value 0.
+                                     0 if the port is not the active port */
+    int32_t  videoLatency;      /*!< Video latency in ms after the transition, as dsGetAVLatency(). Max value 500ms. Min value 0.
+                                     0 if the port is not the active port */
+} dsHdmiInGameModeResult_t;
+
 #endif // End of __DS_HDMI_IN_TYPES_H__
 
 /** @} */ // End of dsHdmiIn_HAL_Type_H
@@ -79,6 +79,7 @@ extern "C" {
 #endif
 
 #include "dsError.h"
+#include "dsAVDTypes.h"
 
 #define EDID_DATA_SIZE 256
 #define EDID_MAX_DATA_SIZE 512
@@ -179,6 +180,57 @@ dsError_t dsGetSocIDFromSDK(char *socID);
  */
 dsError_t dsGetHostEDID(unsigned char *edid, int *length);
 
+/**
+ * @brief Acquires a read-only view of the host EDID.
+ *
+ * This function returns a pointer to the EDID block held by the HAL instead of copying it.
+ * Each successful call takes a reference on the block that must be dropped with dsReleaseHostEDIDView().
+ * The block is kept alive while referenced, so a view stays valid across EDID changes; the
+ * generation in the view tells the caller whether it still matches the current EDID.
+ * The generation is incremented whenever the host EDID changes, and by dsHostInit().
+ * It never goes backwards: it is not reset by dsHostTerm() and dsHostInit() within the life of the process,
+ * and a re-initialisation counts as a change of the EDID.
+ *
+ * @param[out] view         - View to be filled.  Please refer ::dsEDIDView_t
+ *
+ * @return dsError_t                        - Status
+ * @retval dsERR_NONE                       - Success
+ * @retval dsERR_NOT_INITIALIZED            - Module is not initialised
+ * @retval dsERR_INVALID_PARAM              - Parameter passed to this function is invalid
+ * @retval dsERR_OPERATION_NOT_SUPPORTED    - The attempted operation is not supported
+ * @retval dsERR_GENERAL                    - Underlying undefined platform error
+ *
+ * @pre dsHostInit() must be called before this function.
+ * @post dsReleaseHostEDIDView() must be called to release the view.
+ *
+ * @warning  This API is Not thread safe.
+ *
+ * @see dsReleaseHostEDIDView(), dsGetHostEDID()
+ */
+dsError_t dsAcquireHostEDIDView(dsEDIDView_t *view);
+
+/**
+ * @brief Releases a view acquired with dsAcquireHostEDIDView().
+ *
+ * On return, view->data is set to NULL and must not be dereferenced.
+ * All views must be released before the module is terminated.
+ *
+ * @param[in,out] view     - View returned by dsAcquireHostEDIDView().  Please refer ::dsEDIDView_t
+ *
+ * @return dsError_t                        - Status
+ * @retval dsERR_NONE                       - Success
+ * @retval dsERR_NOT_INITIALIZED            - Module is not initialised
+ * @retval dsERR_INVALID_PARAM              - Parameter passed to this function is invalid, or view was not acquired
+ * @retval dsERR_GENERAL                    - Underlying undefined platform error
+ *
+ * @pre dsAcquireHostEDIDView() must be called before calling this API.
+ *
+ * @warning  This API is Not thread safe.
+ *
+ * @see dsAcquireHostEDIDView()
+ */
+dsError_t dsReleaseHostEDIDView(dsEDIDView_t *view);
+
 /** @} */ // End of DSHAL_HOST_API doxygen group 
 /** @} */ // End of DS Host HAL
 /** @} */ // End of Device Settings HAL
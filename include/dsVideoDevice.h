@@ -359,6 +359,9 @@ dsError_t dsGetFRFMode(intptr_t handle, int *frfmode);
  * For sink devices, this function returns the current panel refresh rate of the device.
  * For source devices, this function returns dsERR_OPERATION_NOT_SUPPORTED always.
  *
+ * While a switch scheduled by dsSetDisplayframerate() is pending, this function returns the previous refresh rate.
+ * The new rate is returned once the switch has completed, before ::dsRegisterFrameratePostChangeCB_t is invoked.
+ *
  * @param[in]  handle       - The handle returned from the dsGetVideoDevice() function
  * @param[out] framerate    - Current Panel Refresh Rate will be represented.
  *                            Returns the value as a string(eg:"3840x2160px48" or "3840x2160px120")
@@ -387,6 +390,17 @@ dsError_t dsGetCurrentDisplayframerate(intptr_t handle, char *framerate);
  * For sink devices, this function sets the panel refresh rate for the device.
  * For source devices, this function returns dsERR_OPERATION_NOT_SUPPORTED always.
  *
+ * When no frame rate switch consumer is registered, the switch is applied immediately.
+ * When at least one consumer is registered with dsRegisterFramerateSwitchCB(), this function validates the request,
+ * schedules the switch and returns without waiting for the deadline or the blackout; completion is reported through
+ * ::dsFramerateSwitchReportCB_t and ::dsRegisterFrameratePostChangeCB_t. In that case dsERR_NONE means that the switch has
+ * been scheduled, not that it has been applied: dsGetCurrentDisplayframerate() returns the previous rate until the
+ * switch has completed, and a failure of the switch itself is only reported through ::dsFramerateSwitchReportCB_t.
+ * If this function is called again while a switch is pending:
+ *  - before the switch has started, the pending switch is replaced: it is announced again with a new switchId and
+ *    a new deadline, and acknowledgements of the previous switchId are rejected;
+ *  - after the switch has started, the new switch is scheduled once the current one has completed and been reported.
+ *
  * @param[in] handle    - The handle returned from the dsGetVideoDevice() function
  * @param[in] framerate - Panel Refresh Rate value to be set which is platform-specific.
  *                        Expects the value as a string (eg: "3840x2160px48", "3840x2160px100" or "3840x2160px120").
@@ -394,7 +408,7 @@ dsError_t dsGetCurrentDisplayframerate(intptr_t handle, char *framerate);
  *                        (aaaaxbbbb - panel resolution, "px" - literal separator, yy/yyy - panel refresh rate in 2 or 3 digits)
  *
  * @return dsError_t                        - Status
- * @retval dsERR_NONE                       - Success
+ * @retval dsERR_NONE                       - Success. The switch is applied, or scheduled if a consumer is registered
  * @retval dsERR_NOT_INITIALIZED            - Module is not initialized
  * @retval dsERR_INVALID_PARAM              - Parameter passed to this function is invalid
  * @retval dsERR_OPERATION_NOT_SUPPORTED    - The attempted operation is not supported
@@ -477,6 +491,147 @@ typedef void (*dsRegisterFrameratePostChangeCB_t)(unsigned int tSecond);
  */
 dsError_t dsRegisterFrameratePostChangeCB(dsRegisterFrameratePostChangeCB_t CBFunc);
 
+/**
+ * @brief Call back function to receive the announcement of a scheduled frame rate switch.
+ *
+ * The consumer uses the time until ::dsFramerateSwitch_t::deadlineNs to drain or pause playback, then calls
+ * dsAcknowledgeFramerateSwitch().
+ *
+ * @param [in] consumerId   - Consumer identifier returned by dsRegisterFramerateSwitchCB()
+ * @param [in] info         - Switch announcement.  Please refer ::dsFramerateSwitch_t
+ *                              Only valid for the duration of the callback
+ *
+ * @pre dsVideoDeviceInit(), dsRegisterFramerateSwitchCB() must be called before calling this function.
+ *
+ */
+typedef void (*dsFramerateSwitchAnnounceCB_t)(uint32_t consumerId, const dsFramerateSwitch_t *info);
+
+/**
+ * @brief Call back function to receive the measured result of a frame rate switch.
+ *
+ * @param [in] consumerId   - Consumer identifier returned by dsRegisterFramerateSwitchCB()
+ * @param [in] report       - Switch result.  Please refer ::dsFramerateSwitchReport_t
+ *                              Only valid for the duration of the callback
+ *
+ * @pre dsVideoDeviceInit(), dsRegisterFramerateSwitchCB() must be called before calling this function.
+ *
+ */
+typedef void (*dsFramerateSwitchReportCB_t)(uint32_t consumerId, const dsFramerateSwitchReport_t *report);
+
+/**
+ * @brief Registers a consumer of scheduled frame rate switches.
+ *
+ * For sink devices, once at least one consumer is registered, every display frame rate switch
+ * (e.g. an auto frame rate switch between 23.976, 24 and 25 fps content) is scheduled instead of being applied immediately:
+ *  -# The HAL invokes @a announceCB of every consumer with an absolute deadline, at least the lead time
+ *     set by dsSetFramerateSwitchLeadTime() ahead of it.
+ *  -# The HAL starts the switch when every consumer has called dsAcknowledgeFramerateSwitch(), or at the deadline,
+ *     whichever is first.
+ *  -# Once the panel presents frames at the new rate, the HAL invokes @a reportCB of every consumer with the measured blackout.
+ *
+ * The callbacks registered with dsRegisterFrameratePreChangeCB() and dsRegisterFrameratePostChangeCB() are still
+ * invoked when the switch starts and completes.
+ * For source devices, this function returns dsERR_OPERATION_NOT_SUPPORTED always.
+ *
+ * @param[in]  handle       - The handle returned from the dsGetVideoDevice() function
+ * @param[in]  announceCB   - Function to register for switch announcements.  See dsFramerateSwitchAnnounceCB_t
+ * @param[in]  reportCB     - Function to register for switch results.  See dsFramerateSwitchReportCB_t. May be NULL
+ * @param[out] consumerId   - Identifier of the consumer
+ *
+ * @return dsError_t                        - Status
+ * @retval dsERR_NONE                       - Success
+ * @retval dsERR_NOT_INITIALIZED            - Module is not initialised
+ * @retval dsERR_INVALID_PARAM              - Parameter passed to this function is invalid
+ * @retval dsERR_RESOURCE_NOT_AVAILABLE     - ::dsFRAMERATE_SWITCH_MAX_CONSUMERS consumers are already registered
+ * @retval dsERR_OPERATION_NOT_SUPPORTED    - The attempted operation is not supported
+ * @retval dsERR_GENERAL                    - Underlying undefined platform error
+ *
+ * @pre dsVideoDeviceInit() and dsGetVideoDevice() must be called before calling this function.
+ * @post dsUnregisterFramerateSwitchCB() must be called to remove the consumer.
+ *
+ * @warning  This function is Not thread safe.
+ *
+ * @see dsUnregisterFramerateSwitchCB(), dsAcknowledgeFramerateSwitch(), dsSetFramerateSwitchLeadTime()
+ *
+ */
+dsError_t dsRegisterFramerateSwitchCB(intptr_t handle, dsFramerateSwitchAnnounceCB_t announceCB,
+                                      dsFramerateSwitchReportCB_t reportCB, uint32_t *consumerId);
+
+/**
+ * @brief Removes a consumer of scheduled frame rate switches.
+ *
+ * A pending switch no longer waits for the acknowledgement of the removed consumer.
+ * Once no consumer is registered, frame rate switches are applied immediately again.
+ *
+ * @param[in] handle        - The handle returned from the dsGetVideoDevice() function
+ * @param[in] consumerId    - Identifier returned by dsRegisterFramerateSwitchCB()
+ *
+ * @return dsError_t                        - Status
+ * @retval dsERR_NONE                       - Success
+ * @retval dsERR_NOT_INITIALIZED            - Module is not initialised
+ * @retval dsERR_INVALID_PARAM              - Parameter passed to this function is invalid
+ * @retval dsERR_OPERATION_NOT_SUPPORTED    - The attempted operation is not supported
+ * @retval dsERR_GENERAL                    - Underlying undefined platform error
+ *
+ * @pre dsVideoDeviceInit(), dsGetVideoDevice() and dsRegisterFramerateSwitchCB() must be called before calling this function.
+ *
+ * @warning  This function is Not thread safe.
+ *
+ * @see dsRegisterFramerateSwitchCB()
+ *
+ */
+dsError_t dsUnregisterFramerateSwitchCB(intptr_t handle, uint32_t consumerId);
+
+/**
+ * @brief Sets the minimum lead time between the announcement of a frame rate switch and its deadline.
+ *
+ * For source devices, this function returns dsERR_OPERATION_NOT_SUPPORTED always.
+ *
+ * @param[in] handle    - The handle returned from the dsGetVideoDevice() function
+ * @param[in] leadMs    - Lead time in milliseconds, up to ::dsFRAMERATE_SWITCH_MAX_LEAD_MS. 0 selects the platform default
+ *
+ * @return dsError_t                        - Status
+ * @retval dsERR_NONE                       - Success
+ * @retval dsERR_NOT_INITIALIZED            - Module is not initialised
+ * @retval dsERR_INVALID_PARAM              - Parameter passed to this function is invalid
+ * @retval dsERR_OPERATION_NOT_SUPPORTED    - The attempted operation is not supported
+ * @retval dsERR_GENERAL                    - Underlying undefined platform error
+ *
+ * @pre dsVideoDeviceInit() and dsGetVideoDevice() must be called before calling this function.
+ *
+ * @warning  This function is Not thread safe.
+ *
+ * @see dsRegisterFramerateSwitchCB()
+ *
+ */
+dsError_t dsSetFramerateSwitchLeadTime(intptr_t handle, uint32_t leadMs);
+
+/**
+ * @brief Acknowledges that a consumer is ready for an announced frame rate switch.
+ *
+ * May be called from within the ::dsFramerateSwitchAnnounceCB_t callback.
+ * For source devices, this function returns dsERR_OPERATION_NOT_SUPPORTED always.
+ *
+ * @param[in] handle        - The handle returned from the dsGetVideoDevice() function
+ * @param[in] consumerId    - Identifier returned by dsRegisterFramerateSwitchCB()
+ * @param[in] switchId      - ::dsFramerateSwitch_t::switchId of the announcement
+ *
+ * @return dsError_t                        - Status
+ * @retval dsERR_NONE                       - Success
+ * @retval dsERR_NOT_INITIALIZED            - Module is not initialised
+ * @retval dsERR_INVALID_PARAM              - Parameter passed to this function is invalid, or switchId is not the pending switch
+ * @retval dsERR_OPERATION_NOT_SUPPORTED    - The attempted operation is not supported
+ * @retval dsERR_GENERAL                    - Underlying undefined platform error
+ *
+ * @pre dsVideoDeviceInit(), dsGetVideoDevice() and dsRegisterFramerateSwitchCB() must be called before calling this function.
+ *
+ * @note This function is thread safe.
+ *
+ * @see dsRegisterFramerateSwitchCB()
+ *
+ */
+dsError_t dsAcknowledgeFramerateSwitch(intptr_t handle, uint32_t consumerId, uint32_t switchId);
+
 
 #ifdef __cplusplus
 }
@@ -114,6 +114,8 @@
 
 #pragma once
 #include <sys/types.h>
+#include <stdint.h>
+#include <stdbool.h>
 
 
 
@@ -194,6 +196,45 @@ typedef struct
     dsVideoCodecProfileSupport_t entries[10];  /*!< Contains a list of the supported Codex profiles */
 } dsVideoCodecInfo_t;
 
+/**
+ * @brief Maximum length of a display frame rate string, including the terminating NUL.
+ * @see dsSetDisplayframerate()
+ */
+#define dsVIDEO_DEVICE_FRAMERATE_MAX_LEN 32
+
+/**
+ * @brief Maximum number of frame rate switch consumers the HAL must support.
+ * @see dsRegisterFramerateSwitchCB()
+ */
+#define dsFRAMERATE_SWITCH_MAX_CONSUMERS 4
+
+/**
+ * @brief Maximum lead time, in milliseconds, between the announcement of a frame rate switch and its deadline.
+ * @see dsSetFramerateSwitchLeadTime()
+ */
+#define dsFRAMERATE_SWITCH_MAX_LEAD_MS 2000
+
+/**
+ * @brief Structure type announcing a scheduled display frame rate switch.
+ */
+typedef struct _dsFramerateSwitch_t {
+    uint32_t switchId;                                          /*!< Identifier of the switch, passed to dsAcknowledgeFramerateSwitch() */
+    uint64_t deadlineNs;                                        /*!< CLOCK_MONOTONIC time, in nanoseconds, at which the panel will start to re-sync */
+    uint32_t expectedBlackoutMs;                                /*!< Platform estimate of the blackout duration in milliseconds */
+    char targetFramerate[dsVIDEO_DEVICE_FRAMERATE_MAX_LEN];     /*!< Frame rate being switched to. Same format as dsGetCurrentDisplayframerate() */
+} dsFramerateSwitch_t;
+
+/**
+ * @brief Structure type reporting a completed display frame rate switch.
+ */
+typedef struct _dsFramerateSwitchReport_t {
+    uint32_t switchId;              /*!< Identifier of the switch.  As ::dsFramerateSwitch_t */
+    uint64_t blackoutStartNs;       /*!< CLOCK_MONOTONIC time, in nanoseconds, at which the panel stopped presenting frames */
+    uint64_t blackoutEndNs;         /*!< CLOCK_MONOTONIC time, in nanoseconds, at which the panel presented the first frame at the new rate */
+    uint32_t blackoutMs;            /*!< Measured blackout duration in milliseconds */
+    bool acknowledged;              /*!< @a true if every consumer acknowledged before the switch started, @a false if the deadline expired first */
+} dsFramerateSwitchReport_t;
+
 #endif // End of __DS_VIDEO_DEVICE_TYPES_H__
 
 /** @} */ // End of DSHAL_VIDEODEVICE_TYPES
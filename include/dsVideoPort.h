@@ -798,6 +798,80 @@ dsError_t dsGetQuantizationRange(intptr_t handle, dsDisplayQuantizationRange_t*
  */
 dsError_t dsGetCurrentOutputSettings(intptr_t handle, dsHDRStandard_t* video_eotf, dsDisplayMatrixCoefficients_t* matrix_coefficients, dsDisplayColorSpace_t* color_space, unsigned int* color_depth, dsDisplayQuantizationRange_t* quantization_range);
 
+/**
+ * @brief Gets a consistent snapshot of the requested state of the specified video port in one call.
+ *
+ * This function fills every group requested in snapshot->requestedMask, equivalent to calling
+ * dsIsVideoPortEnabled(), dsIsDisplayConnected(), dsIsVideoPortActive(), dsGetResolution(), dsGetHDCPStatus(),
+ * dsIsOutputHDR(), dsGetPreferredColorDepth() and dsGetCurrentOutputSettings() individually.
+ * All returned values must reflect the same instant; the implementation must not release the port
+ * state between filling two groups. Implementations should serve all groups from a single driver query
+ * where the SoC allows it.
+ * See ::dsVideoPortStateSnapshot_t for the size and mask contract.
+ *
+ * @param[in]     handle    - Handle of the video port returned from dsGetVideoPort()
+ * @param[in,out] snapshot  - Snapshot to be filled.  Please refer ::dsVideoPortStateSnapshot_t
+ *
+ * @return dsError_t                      -  Status
+ * @retval dsERR_NONE                     -  Success; snapshot->validMask holds the filled groups
+ * @retval dsERR_NOT_INITIALIZED          -  Module is not initialised
+ * @retval dsERR_INVALID_PARAM            -  handle is invalid, snapshot is NULL, or size is smaller than
+ *                                           offsetof(dsVideoPortStateSnapshot_t, validMask) + sizeof(uint32_t)
+ * @retval dsERR_OPERATION_NOT_SUPPORTED  -  None of the requested groups are supported
+ * @retval dsERR_GENERAL                  -  Underlying undefined platform error
+ *
+ * @pre dsVideoPortInit() and dsGetVideoPort() must be called before calling this API.
+ *
+ * @warning  This API is Not thread safe.
+ *
+ * @see dsGetCurrentOutputSettings()
+ */
+dsError_t dsGetVideoPortStateSnapshot(intptr_t handle, dsVideoPortStateSnapshot_t *snapshot);
+
+/**
+ * @brief Callback function to notify a change of the output settings of a video port.
+ *
+ * HAL Implementation must invoke this callback whenever any of the values returned by dsGetCurrentOutputSettings()
+ * changes (EOTF, matrix coefficients, color space, color depth or quantization range), with all of the new values.
+ * One invocation is made per change of the output signal, however many of the values changed.
+ *
+ * @param[in] handle    - Handle of the video port returned from dsGetVideoPort()
+ * @param[in] settings  - New output settings.  Please refer ::dsVideoPortOutputSettings_t
+ *                          Only valid for the duration of the callback
+ *
+ * @pre dsRegisterOutputSettingsChangeCallback()
+ */
+typedef void (*dsOutputSettingsChangeCallback_t)(intptr_t handle, const dsVideoPortOutputSettings_t *settings);
+
+/**
+ * @brief Callback Registration for the output settings change event.
+ *
+ * This function registers a callback function to receive output settings changes of the specified video port,
+ * so that the caller does not need to poll dsGetCurrentOutputSettings(). ::dsVideoFormatUpdateCB_t continues to be
+ * invoked for EOTF changes.
+ *
+ * @note Application must install at most one callback function per handle.
+ * Multiple listeners are supported at application layer and thus not
+ * required in HAL implementation.
+ *
+ * @param[in] handle    - Handle of the video port returned from dsGetVideoPort()
+ * @param[in] cb        - Callback function.  Please refer ::dsOutputSettingsChangeCallback_t
+ *
+ * @return dsError_t                      -  Status
+ * @retval dsERR_NONE                     -  Success
+ * @retval dsERR_NOT_INITIALIZED          -  Module is not initialised
+ * @retval dsERR_INVALID_PARAM            -  Parameter passed to this function is invalid
+ * @retval dsERR_OPERATION_NOT_SUPPORTED  -  The attempted operation is not supported
+ * @retval dsERR_GENERAL                  -  Underlying undefined platform error
+ *
+ * @pre dsVideoPortInit() and dsGetVideoPort() must be called before calling this API.
+ *
+ * @warning  This API is Not thread safe.
+ *
+ * @see dsGetCurrentOutputSettings()
+ */
+dsError_t dsRegisterOutputSettingsChangeCallback(intptr_t handle, dsOutputSettingsChangeCallback_t cb);
+
 /**
  * @brief Checks if video output is HDR or not.
  *